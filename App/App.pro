@@ -19,6 +19,7 @@ SOURCES += \
     celipsa.cpp \
     ckrug.cpp \
     clinija.cpp \
+    coblik.cpp \
     cpoligon.cpp \
     ctacka.cpp \
     cxosa.cpp \
@@ -28,7 +29,13 @@ SOURCES += \
     mainwindow.cpp \
     "../Cons/afin.cpp" \
     "../Cons/geom.cpp" \
+    "../Cons/jezgro.cpp" \
+    "../Cons/lanac.cpp" \
+    "../Cons/mapa.cpp" \
+    "../Cons/mreza.cpp" \
     "../Cons/oblik.cpp" \
+    "../Cons/paralelno.cpp" \
+    "../Cons/scena.cpp" \
     "../Cons/tacka.cpp"
 
 HEADERS += \
@@ -39,7 +46,14 @@ HEADERS += \
     "../Cons/afin.hpp" \
     "../Cons/alijasi.hpp" \
     "../Cons/geom.hpp" \
+    "../Cons/jezgro.hpp" \
+    "../Cons/lanac.hpp" \
+    "../Cons/mapa.hpp" \
+    "../Cons/mreza.hpp" \
     "../Cons/oblik.hpp" \
+    "../Cons/okvir.hpp" \
+    "../Cons/paralelno.hpp" \
+    "../Cons/scena.hpp" \
     "../Cons/tacka.hpp" \
     "../Cons/util.hpp"
 
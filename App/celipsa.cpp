@@ -4,8 +4,8 @@
 #include "Boje.hpp"
 
 // klasa celipsa : Element graficke scene koji predstavlja elipsu
-crtanje::celipsa::celipsa(geom::elipsa& e)
-    : odgovarajuca_elipsa(e) {};
+crtanje::celipsa::celipsa(const geom::elipsa& e)
+    : coblik(geom::Tip::elipsa), odgovarajuca_elipsa(e) {};
 
 // Crtanje elementa klase celipsa (nasledjena iz klase elementa graficke scene)
 void crtanje::celipsa::paint(QPainter* painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
@@ -30,25 +30,31 @@ void crtanje::celipsa::paint(QPainter* painter, const QStyleOptionGraphicsItem *
     painter->drawEllipse(centar[0] - a, centar[1] - b, 2 * a, 2 * b);
 }
 
-// Pomocna funkcija za detekciju kolizije (nasledjena iz klase elementa graficke scene)
-QPainterPath crtanje::celipsa::shape() const
+// Dohvatac za elipsu
+const geom::elipsa& crtanje::celipsa::elipsa() const
 {
-    QPainterPath path;
-    auto centar = odgovarajuca_elipsa.tacke()[0];
-    auto a = odgovarajuca_elipsa.tacke()[1][0] - centar[0];
-    auto b = odgovarajuca_elipsa.tacke()[2][1] - centar[1];
+    return odgovarajuca_elipsa;
+}
 
-    if(a < 0)
-        a = (-a);
-    if(b < 0)
-        b = (-b);
+// Novi element sa kopijom elipse
+crtanje::coblik* crtanje::celipsa::kopija() const
+{
+    return new celipsa(odgovarajuca_elipsa);
+}
 
-    path.addEllipse(centar[0] - 1.5 * a, centar[1] - 1.5 * b, 4 * a, 4 * b);
-    return path;
+// Oblik koji element predstavlja
+geom::oblik& crtanje::celipsa::odgovarajuci_oblik()
+{
+    return odgovarajuca_elipsa;
 }
 
-// Pomocna funkcija za iscrtavanje (nasledjena iz klase elementa graficke scene)
-QRectF crtanje::celipsa::boundingRect() const
+const geom::oblik& crtanje::celipsa::odgovarajuci_oblik() const
+{
+    return odgovarajuca_elipsa;
+}
+
+// Racunanje okvira za iscrtavanje i putanje za detekciju kolizije
+void crtanje::celipsa::racunaj(QRectF& okvir, QPainterPath& putanja) const
 {
     auto centar = odgovarajuca_elipsa.tacke()[0];
     auto a = odgovarajuca_elipsa.tacke()[1][0] - centar[0];
@@ -59,5 +65,8 @@ QRectF crtanje::celipsa::boundingRect() const
     if(b < 0)
         b = (-b);
 
-    return QRectF(centar[0] - 2 * a, centar[1] - 2 * b, 4 * a, 4 * b);
+    okvir = QRectF(centar[0] - 2 * a, centar[1] - 2 * b, 4 * a, 4 * b);
+
+    putanja = QPainterPath();
+    putanja.addEllipse(centar[0] - 1.5 * a, centar[1] - 1.5 * b, 4 * a, 4 * b);
 }
@@ -5,8 +5,8 @@
 #include <cstdlib>
 
 // klasa ckrug : Element graficke scene koji predstavlja elipsu
-crtanje::ckrug::ckrug(geom::krug& k)
-    : odgovarajuci_krug(k) {};
+crtanje::ckrug::ckrug(const geom::krug& k)
+    : coblik(geom::Tip::krug), odgovarajuci_krug(k) {};
 
 // Crtanje elementa klase ckrug (nasledjena iz klase elementa graficke scene)
 void crtanje::ckrug::paint(QPainter* painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
@@ -26,24 +26,38 @@ void crtanje::ckrug::paint(QPainter* painter, const QStyleOptionGraphicsItem *op
     painter->drawEllipse(centar[0] - r, centar[1] -r, 2*r, 2*r);
 }
 
-// Pomocna funkcija za detekciju kolizije (nasledjena iz klase elementa graficke scene)
-QPainterPath crtanje::ckrug::shape() const
+// Dohvatac za krug
+const geom::krug& crtanje::ckrug::krug() const
 {
-    QPainterPath path;
-    auto centar = odgovarajuci_krug.tacke()[0];
-    auto tacka_na_krugu = odgovarajuci_krug.tacke()[1];
-    auto r = tacka_na_krugu[0] - centar[0];
+    return odgovarajuci_krug;
+}
+
+// Novi element sa kopijom kruga
+crtanje::coblik* crtanje::ckrug::kopija() const
+{
+    return new ckrug(odgovarajuci_krug);
+}
+
+// Oblik koji element predstavlja
+geom::oblik& crtanje::ckrug::odgovarajuci_oblik()
+{
+    return odgovarajuci_krug;
+}
 
-    path.addEllipse(centar[0] - 1.5 * r, centar[1] - 1.5 * r, 4 * r, 4 * r);
-    return path;
+const geom::oblik& crtanje::ckrug::odgovarajuci_oblik() const
+{
+    return odgovarajuci_krug;
 }
 
-// Pomocna funkcija za iscrtavanje (nasledjena iz klase elementa graficke scene)
-QRectF crtanje::ckrug::boundingRect() const
+// Racunanje okvira za iscrtavanje i putanje za detekciju kolizije
+void crtanje::ckrug::racunaj(QRectF& okvir, QPainterPath& putanja) const
 {
     auto centar = odgovarajuci_krug.tacke()[0];
     auto tacka_na_krugu = odgovarajuci_krug.tacke()[1];
     auto r = tacka_na_krugu[0] - centar[0];
 
-    return QRectF(centar[0] - 2 * r, centar[1] - 2 * r, 4 * r, 4 * r);
+    okvir = QRectF(centar[0] - 2 * r, centar[1] - 2 * r, 4 * r, 4 * r);
+
+    putanja = QPainterPath();
+    putanja.addEllipse(centar[0] - 1.5 * r, centar[1] - 1.5 * r, 4 * r, 4 * r);
 }
@@ -0,0 +1,74 @@
+#include "crtanje.hpp"
+
+// klasa coblik : Zajednicka nadklasa elemenata graficke scene koji predstavljaju oblike
+crtanje::coblik::coblik(const geom::Tip t)
+    : tip_oblika(t) {};
+
+// Element oblika prepoznat po tipu elementa, bez dynamic_cast
+crtanje::coblik* crtanje::coblik::iz(QGraphicsItem* element)
+{
+    const auto t = element->type();
+    if (t == oznaka(geom::Tip::poligon)
+     || t == oznaka(geom::Tip::elipsa)
+     || t == oznaka(geom::Tip::krug))
+        return static_cast<coblik*>(element);
+
+    return nullptr;
+}
+
+// Pomocna funkcija za iscrtavanje (nasledjena iz klase elementa graficke scene);
+// okvir se cuva u elementu i racuna iznova samo posle izmene oblika
+QRectF crtanje::coblik::boundingRect() const
+{
+    if (!vazi) {
+        racunaj(okvir, putanja);
+        vazi = true;
+    }
+
+    return okvir;
+}
+
+// Pomocna funkcija za detekciju kolizije (nasledjena iz klase elementa graficke scene);
+// putanja se ne pravi pri svakom pozivu, vec samo posle izmene oblika
+QPainterPath crtanje::coblik::shape() const
+{
+    if (!vazi) {
+        racunaj(okvir, putanja);
+        vazi = true;
+    }
+
+    return putanja;
+}
+
+// Tip elementa (nasledjena iz klase elementa graficke scene)
+int crtanje::coblik::type() const
+{
+    return oznaka(tip_oblika);
+}
+
+// Dohvatac za tip oblika
+geom::Tip crtanje::coblik::tip() const
+{
+    return tip_oblika;
+}
+
+// Dohvatac za oblik
+const geom::oblik& crtanje::coblik::oblik() const
+{
+    return odgovarajuci_oblik();
+}
+
+// Izmena oblika u mestu; scena se pre izmene
+// obavestava o promeni okvira, a sacuvani se ponistava
+geom::oblik& crtanje::coblik::izmeni()
+{
+    prepareGeometryChange();
+    vazi = false;
+    return odgovarajuci_oblik();
+}
+
+// Transformacija oblika u mestu
+void crtanje::coblik::transformisi(const geom::geom& g)
+{
+    izmeni().transformisi(g);
+}
@@ -3,11 +3,22 @@
 
 #include "Boje.hpp"
 
-// klasa cpoligon : Element graficke scene koji predstavlja poligon
-crtanje::cpoligon::cpoligon(geom::poly& p)
-    : odgovarajuci_poligon(p) {};
+#include <QStyleOptionGraphicsItem>
+#include <algorithm>
+#include <cmath>
+
+// klasa cpoligon : Element graficke scene koji predstavlja poligon;
+// crtacu se prosledjuje izlozeni pravougaonik, radi odsecanja
+crtanje::cpoligon::cpoligon(const geom::poly& p)
+    : coblik(geom::Tip::poligon), odgovarajuci_poligon(p)
+{
+    setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+}
 
-// Crtanje elementa klase cpoligon (nasledjena iz klase elementa graficke scene)
+// Crtanje elementa klase cpoligon (nasledjena iz klase elementa graficke scene);
+// ivice van vidljivog dela se preskacu, a od temena koja su na ekranu bliza od
+// piksela prethodnom crta se samo poslednje, pa svaka vidljiva izlomljena
+// linija ide u jednom pozivu crtaca, sa brojem temena srazmernim broju piksela
 void crtanje::cpoligon::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
     Q_UNUSED(widget)
@@ -15,64 +26,94 @@ void crtanje::cpoligon::paint(QPainter* painter, const QStyleOptionGraphicsItem*
     QPen p;
     p.setWidth(1);
     painter->setPen(p);
-    auto tacke = odgovarajuci_poligon.tacke();
-
-    auto prva_tacka = tacke[0];
-    auto pocetna_tacka = tacke[0];
-    auto druga_tacka = tacke[1];
-
-    ctacka c_pocetna_tacka (tacke[0]);
-    ctacka c_druga_tacka (tacke[1]);
-
-
-    painter->drawLine(pocetna_tacka[0], pocetna_tacka[1],
-                      druga_tacka[0], druga_tacka[1]);
-
-    for (auto i = 1; i < tacke.size() - 1 ; i++)
-    {
 
-        pocetna_tacka = tacke[i];
-        druga_tacka   = tacke[i+1];
-
-        ctacka c_druga_tacka (tacke[i+1]);
-        painter->drawLine(pocetna_tacka[0], pocetna_tacka[1],
-                          druga_tacka[0], druga_tacka[1]);
-    }
+    const auto& tacke = odgovarajuci_poligon.tacke();
+    const auto n = tacke.size();
+    if (n < 2)
+        return;
+
+    // Velicina piksela u koordinatama elementa
+    const auto lod = QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform());
+    const auto piksel = lod > 0 ? 1 / lod : 0;
+
+    // Vidljiv deo, prosiren za debljinu olovke
+    const auto vidljivo = option->exposedRect.adjusted(-piksel, -piksel, piksel, piksel);
+
+    QPolygonF linija;
+    QPointF preskocena;
+    auto ima_preskocene = false;
+
+    // Crtanje zapocete linije; poslednje preskoceno
+    // teme se ipak dodaje, da linija ne bi bila kraca
+    const auto zavrsi = [&]() {
+        if (ima_preskocene)
+            linija << preskocena;
+        if (linija.size() > 1)
+            painter->drawPolyline(linija);
+        linija.clear();
+        ima_preskocene = false;
+    };
+
+    const auto ivica = [&](const geom::tacka& a, const geom::tacka& b) {
+        const QPointF od(a.koord()[0], a.koord()[1]);
+        const QPointF ka(b.koord()[0], b.koord()[1]);
+
+        // Ivica ciji okvir ne sece vidljiv deo prekida liniju
+        if (std::max(od.x(), ka.x()) < vidljivo.left() || std::min(od.x(), ka.x()) > vidljivo.right()
+         || std::max(od.y(), ka.y()) < vidljivo.top() || std::min(od.y(), ka.y()) > vidljivo.bottom()) {
+            zavrsi();
+            return;
+        }
+
+        if (linija.isEmpty())
+            linija << od;
+
+        const auto& poslednja = linija.back();
+        if (std::abs(ka.x() - poslednja.x()) < piksel && std::abs(ka.y() - poslednja.y()) < piksel) {
+            preskocena = ka;
+            ima_preskocene = true;
+        } else {
+            linija << ka;
+            ima_preskocene = false;
+        }
+    };
+
+    for (std::size_t i = 0; i + 1 < n; i++)
+        ivica(tacke[i], tacke[i+1]);
 
     if (odgovarajuci_poligon.zatvoren())
-    {
-        painter->drawLine(prva_tacka[0], prva_tacka[1],
-                          druga_tacka[0], druga_tacka[1]);
-    }
+        ivica(tacke[n-1], tacke[0]);
 
+    zavrsi();
 }
 
-// Pomocna funkcija za iscrtavanje (nasledjena iz klase elementa graficke scene)
-QRectF crtanje::cpoligon::boundingRect() const {
-       const auto [min_x, max_x] = std::minmax_element(std::cbegin(odgovarajuci_poligon.tacke()),
-                                                        std::cend(odgovarajuci_poligon.tacke()),
-                                                        [](const auto& a,
-                                                           const auto& b)
-                                                        {return a[0] < b[0];});
-
-        const auto [min_y, max_y] = std::minmax_element(std::cbegin(odgovarajuci_poligon.tacke()),
-                                                        std::cend(odgovarajuci_poligon.tacke()),
-                                                        [](const auto& a,
-                                                           const auto& b)
-                                                        {return a[1] < b[1];});
+// Dohvatac za poligon
+const geom::poly& crtanje::cpoligon::poligon() const {
+    return odgovarajuci_poligon;
+}
 
-        const auto mini_x = (*min_x)[0];
-        const auto maxi_x = (*max_x)[0];
+// Novi element sa kopijom poligona
+crtanje::coblik* crtanje::cpoligon::kopija() const {
+    return new cpoligon(odgovarajuci_poligon);
+}
 
-        const auto mini_y = (*min_y)[1];
-        const auto maxi_y = (*max_y)[1];
+// Oblik koji element predstavlja
+geom::oblik& crtanje::cpoligon::odgovarajuci_oblik() {
+    return odgovarajuci_poligon;
+}
 
-        return QRectF(mini_x, mini_y, (maxi_x - mini_x), (maxi_y - mini_y));
+const geom::oblik& crtanje::cpoligon::odgovarajuci_oblik() const {
+    return odgovarajuci_poligon;
 }
 
-// Pomocna funkcija za detekciju kolizije (nasledjena iz klase elementa graficke scene)
-QPainterPath crtanje::cpoligon::shape() const {
-    QPainterPath path;
-    path.addRect(boundingRect());
-    return path;
+// Racunanje okvira i putanje; okvir se uzima iz poligona,
+// pa poziv ne prolazi kroz sve tacke, a putanja za koliziju
+// je sam okvir
+void crtanje::cpoligon::racunaj(QRectF& okvir, QPainterPath& putanja) const {
+    const auto o = odgovarajuci_poligon.okvir();
+    okvir = o.prazan() ? QRectF()
+                       : QRectF(o.min_x, o.min_y, o.max_x - o.min_x, o.max_y - o.min_y);
+
+    putanja = QPainterPath();
+    putanja.addRect(okvir);
 }
@@ -9,6 +9,7 @@
 #include "../Cons/geom.hpp"
 #include "../Cons/tacka.hpp"
 #include "../Cons/oblik.hpp"
+#include "../Cons/scena.hpp"
 #include "geom_graphics_view.hpp"
 
 // Imenski prostor za crtacke klase
@@ -103,45 +104,127 @@ public:
 /***** OBLICI *****/
 /*****************/
 
-// Element na grafickoj sceni koji predstavlja poligon
-class cpoligon : public QGraphicsItem {
+// Zajednicka nadklasa elemenata na grafickoj sceni koji
+// predstavljaju oblike; tip oblika je oznacen tipom elementa,
+// pa se element oblika prepoznaje bez dynamic_cast; okvir i
+// putanja za koliziju se cuvaju i racunaju iznova tek posle
+// izmene oblika, koja ide kroz sam element, da bi scena pre
+// nje mogla da azurira svoj indeks
+class coblik : public QGraphicsItem {
 public:
-    cpoligon(geom::poly& );
+    // Oznaka tipa elementa za dati tip oblika
+    static constexpr int oznaka(const geom::Tip t) {
+        return UserType + 1 + static_cast<int>(t);
+    }
+
+    // Element oblika ili nullptr za ostale elemente
+    static coblik* iz(QGraphicsItem* );
 
     QRectF boundingRect() const Q_DECL_OVERRIDE;
 
+    QPainterPath shape() const Q_DECL_OVERRIDE;
+
+    int type() const Q_DECL_OVERRIDE;
+
+    // Dohvatac za tip oblika
+    geom::Tip tip() const;
+
+    // Dohvatac za oblik
+    const geom::oblik& oblik() const;
+
+    // Izmena oblika u mestu; scena se odmah obavestava
+    // o promeni okvira, a sacuvani okvir i putanja se
+    // ponistavaju, pa izmena mora biti gotova pre nego
+    // sto scena ponovo zatrazi geometriju elementa
+    geom::oblik& izmeni();
+
+    // Transformacija oblika u mestu
+    void transformisi(const geom::geom& );
+
+    // Novi element sa kopijom oblika
+    virtual coblik* kopija() const = 0;
+
+protected:
+    coblik(const geom::Tip );
+
+    // Oblik koji element predstavlja
+    virtual geom::oblik& odgovarajuci_oblik() = 0;
+    virtual const geom::oblik& odgovarajuci_oblik() const = 0;
+
+    // Racunanje okvira i putanje za koliziju
+    virtual void racunaj(QRectF& , QPainterPath& ) const = 0;
+
+private:
+    geom::Tip tip_oblika;
+
+    mutable QRectF okvir;
+    mutable QPainterPath putanja;
+    mutable bool vazi = false;
+};
+
+// Element na grafickoj sceni koji predstavlja poligon
+class cpoligon : public coblik {
+public:
+    cpoligon(const geom::poly& );
+
     void paint(QPainter* , const QStyleOptionGraphicsItem* , QWidget* ) Q_DECL_OVERRIDE;
 
-    QPainterPath shape() const Q_DECL_OVERRIDE;
+    // Dohvatac za poligon
+    const geom::poly& poligon() const;
+
+    coblik* kopija() const Q_DECL_OVERRIDE;
+
+protected:
+    geom::oblik& odgovarajuci_oblik() Q_DECL_OVERRIDE;
+    const geom::oblik& odgovarajuci_oblik() const Q_DECL_OVERRIDE;
 
+    void racunaj(QRectF& , QPainterPath& ) const Q_DECL_OVERRIDE;
+
+private:
     geom::poly odgovarajuci_poligon;
 };
 
 // Element na grafickoj sceni koji predstavlja elipsa
-class celipsa : public QGraphicsItem {
+class celipsa : public coblik {
 public:
-    celipsa(geom::elipsa& );
-
-    QRectF boundingRect() const Q_DECL_OVERRIDE;
+    celipsa(const geom::elipsa& );
 
     void paint(QPainter* , const QStyleOptionGraphicsItem* , QWidget* ) Q_DECL_OVERRIDE;
 
-    QPainterPath shape() const Q_DECL_OVERRIDE;
+    // Dohvatac za elipsu
+    const geom::elipsa& elipsa() const;
+
+    coblik* kopija() const Q_DECL_OVERRIDE;
+
+protected:
+    geom::oblik& odgovarajuci_oblik() Q_DECL_OVERRIDE;
+    const geom::oblik& odgovarajuci_oblik() const Q_DECL_OVERRIDE;
 
+    void racunaj(QRectF& , QPainterPath& ) const Q_DECL_OVERRIDE;
+
+private:
     geom::elipsa odgovarajuca_elipsa;
 };
 
 // Element na grafickoj sceni koji predstavlja krug
-class ckrug : public QGraphicsItem {
+class ckrug : public coblik {
 public:
-    ckrug(geom::krug& );
-
-    QRectF boundingRect() const Q_DECL_OVERRIDE;
+    ckrug(const geom::krug& );
 
     void paint(QPainter* , const QStyleOptionGraphicsItem* , QWidget* ) Q_DECL_OVERRIDE;
 
-    QPainterPath shape() const Q_DECL_OVERRIDE;
+    // Dohvatac za krug
+    const geom::krug& krug() const;
 
+    coblik* kopija() const Q_DECL_OVERRIDE;
+
+protected:
+    geom::oblik& odgovarajuci_oblik() Q_DECL_OVERRIDE;
+    const geom::oblik& odgovarajuci_oblik() const Q_DECL_OVERRIDE;
+
+    void racunaj(QRectF& , QPainterPath& ) const Q_DECL_OVERRIDE;
+
+private:
     geom::krug odgovarajuci_krug;
 };
 
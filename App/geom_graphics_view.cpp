@@ -10,7 +10,7 @@
 
 // geom_graphics_view : Nasa podklasa grafickog pogleda na scenu
 geom_graphics_view::geom_graphics_view(QWidget* parent)
-    : QGraphicsView(parent)
+    : QGraphicsView(parent), sve_tacke(MESH_CELL)
 {
    // Podesavamo graficke parametre scene.
    QGraphicsScene* scena = new QGraphicsScene(this);
@@ -23,6 +23,15 @@ geom_graphics_view::geom_graphics_view(QWidget* parent)
    // Skaliranje kako bi y osa isla nagore
    scale(1, -1);
 
+   // Pravougaonik za oznacavanje tacaka; na kraju
+   // povlacenja stizu prazne tacke, pa se preskace
+   setDragMode(QGraphicsView::RubberBandDrag);
+   connect(this, &QGraphicsView::rubberBandChanged,
+           [this](QRect, QPointF od, QPointF ka) {
+               if (!od.isNull() || !ka.isNull())
+                   oznaci_tacke(od, ka);
+           });
+
    nacrtaj_koordinatne_ose();
 
    /***** Ovde samo proveravamo nase metode *****
@@ -60,14 +69,49 @@ void geom_graphics_view::mouseMoveEvent(QMouseEvent* event)
 {
     QGraphicsView::mouseMoveEvent(event);
 
+    // Dok se povlaci pravougaonik, u statusnoj liniji
+    // ostaje broj oznacenih tacaka, a ne polozaj misa
+    if (event->buttons() != Qt::NoButton || !rubberBandRect().isNull())
+        return;
+
     auto sc = mapToScene(event->pos());
 
+    // Poluprecnik privlacenja je u pikselima, pa se
+    // pri svakom uvelicanju preracunava u jedinice scene
+    const auto r = SNAP_RADIUS / std::abs(transform().m11());
+    const auto i = sve_tacke.najbliza(geom::tacka(sc.x(), sc.y()), r);
+
     std::ostringstream s;
-    s << "Trenutni položaj miša: (" << sc.rx() << ", " << sc.ry() << ").";
+    if (i != geom::mreza::nema) {
+        // Polozaj se privlaci tacki ispod kursora
+        const auto& t = sve_tacke.tacke()[i];
+        s << "Tačka ispod miša: (" << t[0] << ", " << t[1] << ").";
+        viewport()->setCursor(Qt::CrossCursor);
+    } else {
+        s << "Trenutni položaj miša: (" << sc.rx() << ", " << sc.ry() << ").";
+        viewport()->unsetCursor();
+    }
+
+    posalji_poruku(s.str());
+}
 
+void geom_graphics_view::oznaci_tacke(const QPointF& od, const QPointF& ka)
+{
+    geom::Okvir okvir;
+    okvir.prosiri(od.x(), od.y());
+    okvir.prosiri(ka.x(), ka.y());
+
+    std::ostringstream s;
+    s << "Označeno tačaka: " << std::size(sve_tacke.u_okviru(okvir)) << ".";
+
+    posalji_poruku(s.str());
+}
+
+void geom_graphics_view::posalji_poruku(const std::string& poruka)
+{
     auto prozor = qobject_cast<MainWindow*>(parentWidget()->parentWidget());
 
-    prozor->posalji_poruku(QString::fromStdString(s.str()));
+    prozor->posalji_poruku(QString::fromStdString(poruka));
 }
 
 void geom_graphics_view::wheelEvent(QWheelEvent* event)
@@ -92,14 +136,16 @@ void geom_graphics_view::nacrtaj_tacku()
     crtanje::ctacka* nova_tacka = new crtanje::ctacka();
     nova_tacka->setPos(0, 0);
     scene()->addItem(nova_tacka);
-    sve_tacke.push_back(geom::Vektor{0, 0});
+    pojedinacne_tacke.emplace_back(0, 0);
+    sve_tacke.dodaj(geom::tacka(0, 0));
 }
 
 void geom_graphics_view::nacrtaj_tacku(const geom::tacka& t) {
     crtanje::ctacka* nova_tacka = new crtanje::ctacka(t);
     nova_tacka->setPos(t[0], t[1]);
     scene()->addItem(nova_tacka);
-    sve_tacke.push_back(geom::Vektor{t[0], t[1]});
+    pojedinacne_tacke.push_back(t);
+    sve_tacke.dodaj(t);
 }
 
 void geom_graphics_view::nacrtaj_liniju (const geom::tacka& pocetak, const geom::tacka& kraj) {
@@ -142,14 +188,39 @@ void geom_graphics_view::nacrtaj_mrezu() {
 void geom_graphics_view::nacrtaj_elipsu(geom::elipsa& e) {
     crtanje::celipsa* nova_elipsa = new crtanje::celipsa(e);
     scene()->addItem(nova_elipsa);
+    dodaj_temena(e);
 }
 
 void geom_graphics_view::nacrtaj_krug(geom::krug& k) {
     crtanje::ckrug* novi_krug = new crtanje::ckrug(k);
     scene()->addItem(novi_krug);
+    dodaj_temena(k);
+}
+
+void geom_graphics_view::obrisi_tacke() {
+    pojedinacne_tacke.clear();
+    sve_tacke.isprazni();
+}
+
+// Mreza se puni iznova, tackama i temenima oblika
+// koji su trenutno na sceni, posle njihove izmene
+void geom_graphics_view::obnovi_tacke() {
+    sve_tacke.isprazni();
+    for (const auto& t : pojedinacne_tacke)
+        sve_tacke.dodaj(t);
+
+    for (auto element : scene()->items())
+        if (auto o = crtanje::coblik::iz(element))
+            dodaj_temena(o->oblik());
 }
 
 void geom_graphics_view::nacrtaj_poligon(geom::poly& p) {
-    crtanje::cpoligon* novi_krug = new crtanje::cpoligon(p);
-    scene()->addItem(novi_krug);
+    crtanje::cpoligon* novi_poligon = new crtanje::cpoligon(p);
+    scene()->addItem(novi_poligon);
+    dodaj_temena(p);
+}
+
+void geom_graphics_view::dodaj_temena(const geom::oblik& o) {
+    for (const auto& t : o.tacke())
+        sve_tacke.dodaj(t);
 }
@@ -13,6 +13,7 @@
 
 #include <vector>
 #include "../Cons/geom.hpp"
+#include "../Cons/mreza.hpp"
 #include "../Cons/oblik.hpp"
 #include "../Cons/util.hpp"
 
@@ -23,6 +24,7 @@
 #define MESH_CELL (50)
 #define POINT_ON_AXIS_SIZE (3)
 #define PENCIL_WEIGHT_AXIS (2)
+#define SNAP_RADIUS (6)
 
 // Nasa podklasa grafickog pogleda na scenu
 class geom_graphics_view : public QGraphicsView
@@ -48,14 +50,31 @@ public:
     void nacrtaj_krug(geom::krug& k);
     void nacrtaj_poligon(geom::poly& p);
 
+    /***** BRISANJE *****/
+    void obrisi_tacke();
+
+    // Ponovno punjenje mreze tacaka posle izmene oblika
+    void obnovi_tacke();
+
 protected:
     void drawBackground(QPainter *, const QRectF &) override;
     void mouseMoveEvent(QMouseEvent *) override;
     void wheelEvent(QWheelEvent *) override;
 
 private:
-    geom::NizTacaka sve_tacke;
+    // Nacrtane tacke u mrezi celija velicine MESH_CELL,
+    // radi brze pretrage pri svakom pomeranju misa
+    geom::mreza sve_tacke;
     void nacrtaj_mrezu();
+
+    // Tacke nacrtane same, van oblika
+    geom::NizTacaka pojedinacne_tacke;
+
+    // Dodavanje temena oblika u mrezu
+    void dodaj_temena(const geom::oblik&);
+
+    void oznaci_tacke(const QPointF&, const QPointF&);
+    void posalji_poruku(const std::string&);
 };
 
 #endif // GEOM_GRAPHICS_VIEW_H
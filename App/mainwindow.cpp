@@ -3,12 +3,14 @@
 #include "geom_graphics_view.hpp"
 
 #include "../Cons/afin.hpp"
+#include "../Cons/paralelno.hpp"
+#include "../Cons/scena.hpp"
 #include "geom_graphics_view.hpp"
 #include "crtanje.hpp"
 
 #include <QDir>
 #include <QFileDialog>
-#include <QTextStream>
+#include <QGraphicsScene>
 #include <QMessageBox>
 
 MainWindow::MainWindow(QWidget *parent)
@@ -70,16 +72,27 @@ void MainWindow::on_pb_krug_clicked()
     ui->graphicsView->nacrtaj_krug(k);
 }
 
+// Elementi se uklanjaju bez indeksa scene, koji bi se
+// inace azurirao za svaki element, a zatim oslobadjaju,
+// jer uklanjanjem sa scene vlasnistvo prelazi na nas
 void MainWindow::on_pb_ocisti_ekran_clicked()
 {
-    auto graficki_elementi = ui->graphicsView->items();
+    auto scena = ui->graphicsView->scene();
+    auto graficki_elementi = scena->items();
 
+    scena->setItemIndexMethod(QGraphicsScene::NoIndex);
     for(auto element: graficki_elementi)
     {
-        if (dynamic_cast<crtanje::cxosa*>(element) == nullptr
-         && dynamic_cast<crtanje::cyosa*>(element) == nullptr)
-            ui->graphicsView->scene()->removeItem(element);
+        if (element != crtanje::cxosa::osa()
+         && element != crtanje::cyosa::osa())
+        {
+            scena->removeItem(element);
+            delete element;
+        }
     }
+    scena->setItemIndexMethod(QGraphicsScene::BspTreeIndex);
+
+    ui->graphicsView->obrisi_tacke();
 }
 
 // Resetujemo sve podatke za transformacije
@@ -137,53 +150,68 @@ void MainWindow::on_pb_primeni_transformacije_clicked()
         return;
     }
 
-    auto graphicItems = ui->graphicsView->scene()->items();
+    auto scena = ui->graphicsView->scene();
+    auto graphicItems = scena->items();
 
-    // HACK: Trenutno 'dovijanje' za nalazenje imena klase
-    // Lose resenje usled nedostatka vremena
-    // Lako se moze ispraviti dodavanjem nadklase za sve graficke elemente
-    // koje predstavljaju oblik
+    // Elementi koji predstavljaju oblike
+    std::vector<crtanje::coblik*> elementi;
     for(auto item: graphicItems){
-        auto element = dynamic_cast<crtanje::cpoligon*>(item);
-        if(element == nullptr){
-            auto e1 = dynamic_cast<crtanje::celipsa*>(item);
-                if (e1 == nullptr){
-                    auto e2 = dynamic_cast<crtanje::ckrug*>(item);
-
-                    if (e2 == nullptr){
-                        continue;
-                    }
-                    // Kada nadjemo tip oblika, uzimamo njegov odgovarajuci geometrijski objekat
-                    // i transformisemo ga. Brisemo trenutni graficki element sa
-                    // scene i crtamo novi koji odgovara istom objektu sa transformisanim koordinatama.
-                    auto odgovarajuci_oblik = e2->odgovarajuci_krug;
-                    ui->graphicsView->scene()->removeItem(item);
-
-                    for (auto& transformacija : transformacije){
-                        auto kopija = odgovarajuci_oblik;
-                        kopija.transformisi(transformacija);
-                        ui->graphicsView->nacrtaj_krug(kopija);
-                    }
-                } else {
-                    auto odgovarajuci_oblik = e1->odgovarajuca_elipsa;
-                    ui->graphicsView->scene()->removeItem(item);
-
-                    for (auto& transformacija : transformacije){
-                        auto kopija = odgovarajuci_oblik;
-                        kopija.transformisi(transformacija);
-                        ui->graphicsView->nacrtaj_elipsu(kopija);
-                    }
-                }
-        } else {
-            auto odgovarajuci_oblik = element->odgovarajuci_poligon;
-            ui->graphicsView->scene()->removeItem(item);
-
-            for (auto& transformacija : transformacije){
-                auto kopija = odgovarajuci_oblik;
-                kopija.transformisi(transformacija);
-                ui->graphicsView->nacrtaj_poligon(kopija);
-            }
+        if (auto element = crtanje::coblik::iz(item)){
+            elementi.push_back(element);
+        }
+    }
+
+    // Indeks scene se iskljucuje dok traju izmene, pa
+    // se posle gradi jednom, umesto po jednom elementu
+    scena->setItemIndexMethod(QGraphicsScene::NoIndex);
+
+    // Svaka transformacija osim poslednje se primenjuje na
+    // nove kopije svih elemenata; scena se transformise paralelno,
+    // na svim jezgrima, a kopije se zatim dodaju na scenu
+    for (std::size_t i = 0; i + 1 < transformacije.size(); i++){
+        std::vector<crtanje::coblik*> kopije;
+        std::vector<geom::oblik*> oblici;
+        for (auto e : elementi){
+            kopije.push_back(e->kopija());
+            oblici.push_back(&kopije.back()->izmeni());
         }
+
+        geom::transformisi(transformacije[i], oblici);
+
+        for (auto e : kopije){
+            scena->addItem(e);
+        }
+    }
+
+    // Poslednja transformacija se primenjuje na postojece
+    // elemente u mestu; svaki se prvo priprema za izmenu,
+    // a zatim se svi oblici transformisu paralelno
+    std::vector<geom::oblik*> oblici;
+    for (auto e : elementi){
+        oblici.push_back(&e->izmeni());
+    }
+
+    geom::transformisi(transformacije.back(), oblici);
+
+    scena->setItemIndexMethod(QGraphicsScene::BspTreeIndex);
+
+    // Tacke za privlacenje su se pomerile sa oblicima
+    ui->graphicsView->obnovi_tacke();
+}
+
+// Crtanje oblika iz scene prema njegovom tipu
+void MainWindow::nacrtaj(geom::oblik& o)
+{
+    switch (o.tip()) {
+    case geom::Tip::poligon:
+        ui->graphicsView->nacrtaj_poligon(static_cast<geom::poly&>(o));
+        break;
+    case geom::Tip::elipsa:
+        ui->graphicsView->nacrtaj_elipsu(static_cast<geom::elipsa&>(o));
+        break;
+    case geom::Tip::krug:
+        ui->graphicsView->nacrtaj_krug(static_cast<geom::krug&>(o));
+        break;
     }
 }
 
@@ -196,109 +224,72 @@ void MainWindow::on_actionU_itaj_scenu_triggered()
 {
     QString ime = QFileDialog::getOpenFileName(this,
                                                tr("Učitajte scenu"), "",
-                                               tr("tekstualni fajl (*.txt)"));
+                                               tr("tekstualni fajl (*.txt);;"
+                                                  "binarni fajl (*.gsc)"));
 
     if (ime.isEmpty()) {
         return;
     }
 
-    QFile file(ime);
-    if (!file.open(QIODevice::ReadOnly)){
-        QMessageBox::information(this, tr("Nije moguće otvoriti fajl!"),
-                                       file.errorString());
-        return;
-    }
-
-    on_pb_ocisti_ekran_clicked();
-
-    QTextStream in(&file);
-
-    // Deserijalizacija svakog elementa
-    while (!in.atEnd()) {
-        QString linija = in.readLine();
-        QStringList tip_tacke = linija.split(":");
-
-        auto tip = tip_tacke.front();
-        auto tacke = tip_tacke.back().split(";");
-
-        geom::NizTacaka niz;
-        for (auto& tacka: tacke){
-            tacka.remove("[");
-            tacka.remove(", 1.00]");
-
-            auto koordinate = tacka.split(", ");
-            auto x = koordinate[0].toDouble();
-            auto y = koordinate[1].toDouble();
-            niz.emplace_back(x, y);
-        }
-
-        if (tip == "poligon"){
-            auto poligon = geom::poly(niz);
-            poligon.zatvori();
-            ui->graphicsView->nacrtaj_poligon(poligon);
-        } else if (tip == "elipsa"){
-            auto elipsa = geom::elipsa(niz[0], niz[1], niz[2]);
-            ui->graphicsView->nacrtaj_elipsu(elipsa);
-        } else if (tip == "krug"){
-            auto krug = geom::krug(niz[0], niz[1]);
-            ui->graphicsView->nacrtaj_krug(krug);
-        } else {
-            QMessageBox::information(this, tr("Greška!"),
-                                           tr("Nije moguće parsirati fajl!"));
-            return;
+    // Scena se mapira u memoriju i ucitava na
+    // svim nitima, a zatim crta redom; putanja
+    // se predaje u UTF-8, koji biblioteka na
+    // Windows-u prevodi u sirok zapis
+    try {
+        const auto putanja = ime.toUtf8().toStdString();
+        const auto scena = ime.endsWith(".gsc")
+                         ? geom::ucitaj_binarno(putanja, geom::niti())
+                         : geom::ucitaj_tekst(putanja, geom::niti());
+
+        on_pb_ocisti_ekran_clicked();
+        for (const auto& o : scena) {
+            nacrtaj(*o);
         }
+    } catch (geom::Exc& e) {
+        QMessageBox::information(this, tr("Greška!"), e.what());
     }
 }
 
 void MainWindow::on_actionSa_uvaj_scenu_triggered()
 {
+    QString filter;
     QString ime = QFileDialog::getSaveFileName(this,
                                                tr("Sačuvajte scenu"), "",
-                                               tr("tekstualni fajl (*.txt)"));
+                                               tr("tekstualni fajl (*.txt);;"
+                                                  "binarni fajl (*.gsc)"),
+                                               &filter);
 
     if (ime.isEmpty()) {
         return;
     }
 
-    QFile file(ime);
-    if (!file.open(QIODevice::WriteOnly)){
-        QMessageBox::information(this, tr("Nije moguće otvoriti fajl!"),
-                                       file.errorString());
-        return;
+    // Oblici elemenata, prepoznatih po tipu elementa
+    std::vector<const geom::oblik*> oblici;
+    for (auto item : ui->graphicsView->scene()->items()) {
+        if (auto element = crtanje::coblik::iz(item)) {
+            oblici.push_back(&element->oblik());
+        }
     }
 
-    QTextStream out(&file);
-
-    // Serijalizacija svakog elementa
-    for (auto item : ui->graphicsView->scene()->items()) {
-        auto poligon = dynamic_cast<crtanje::cpoligon*>(item);
-        auto elipsa = dynamic_cast<crtanje::celipsa*>(item);
-        auto krug = dynamic_cast<crtanje::ckrug*>(item);
-
-        geom::oblik* o;
-
-        if (poligon != nullptr){
-            out << "poligon:";
-            o = &poligon->odgovarajuci_poligon;
-        } else if (elipsa != nullptr){
-            out << "elipsa:";
-            o = &elipsa->odgovarajuca_elipsa;
-        } else if (krug != nullptr) {
-            out << "krug:";
-            o = &krug->odgovarajuci_krug;
-        } else {
-            continue;
+    // Binarna scena se pravi u memoriji i upisuje odjednom
+    if (ime.endsWith(".gsc") || filter.contains("*.gsc")) {
+        if (!ime.endsWith(".gsc")) {
+            ime += ".gsc";
         }
 
-        auto vel = std::size(o->tacke());
-        for (geom::Velicina i = 0; i < vel; i++){
-            out << QString::fromStdString(o->tacke()[i].str());
-            if (i == vel-1){
-                out << "\n";
-            } else {
-                out << ";";
-            }
+        try {
+            geom::sacuvaj_binarno(ime.toUtf8().toStdString(), oblici);
+        } catch (geom::Exc& e) {
+            QMessageBox::information(this, tr("Greška!"), e.what());
         }
+        return;
+    }
+
+    // Serijalizacija oblik po oblik, uz proveru upisa
+    try {
+        geom::sacuvaj_tekst(ime.toUtf8().toStdString(), oblici);
+    } catch (geom::Exc& e) {
+        QMessageBox::information(this, tr("Greška!"), e.what());
     }
 }
 
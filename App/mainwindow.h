@@ -42,6 +42,9 @@ private slots:
     void on_actionNapusti_program_triggered();
 
 private:
+    // Crtanje oblika iz scene prema njegovom tipu
+    void nacrtaj(geom::oblik&);
+
     Ui::MainWindow *ui;
 };
 #endif // MAINWINDOW_H
@@ -0,0 +1,53 @@
+TEMPLATE = app
+CONFIG += console c++17 release
+CONFIG -= app_bundle debug
+CONFIG -= qt
+
+# Merenja imaju smisla samo bez provera
+CONFIG(release, debug|release): DEFINES += NDEBUG
+
+SOURCES += \
+    afin_bench.cpp \
+    geom_bench.cpp \
+    indeks_bench.cpp \
+    main.cpp \
+    merenje.cpp \
+    oblik_bench.cpp \
+    scena_bench.cpp \
+    tacka_bench.cpp \
+    uprosti_bench.cpp \
+    util_bench.cpp \
+    "../Cons/afin.cpp" \
+    "../Cons/geom.cpp" \
+    "../Cons/indeks.cpp" \
+    "../Cons/jezgro.cpp" \
+    "../Cons/lanac.cpp" \
+    "../Cons/mapa.cpp" \
+    "../Cons/mreza.cpp" \
+    "../Cons/oblik.cpp" \
+    "../Cons/paralelno.cpp" \
+    "../Cons/scena.cpp" \
+    "../Cons/tacka.cpp" \
+    "../Cons/uprosti.cpp"
+
+HEADERS += \
+    merenje.hpp \
+    podaci.hpp \
+    "../Cons/afin.hpp" \
+    "../Cons/alijasi.hpp" \
+    "../Cons/geom.hpp" \
+    "../Cons/indeks.hpp" \
+    "../Cons/jezgro.hpp" \
+    "../Cons/lanac.hpp" \
+    "../Cons/mapa.hpp" \
+    "../Cons/mreza.hpp" \
+    "../Cons/oblik.hpp" \
+    "../Cons/okvir.hpp" \
+    "../Cons/paralelno.hpp" \
+    "../Cons/scena.hpp" \
+    "../Cons/tacka.hpp" \
+    "../Cons/uprosti.hpp" \
+    "../Cons/util.hpp"
+
+DISTFILES += \
+    osnova.json
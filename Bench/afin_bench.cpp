@@ -0,0 +1,53 @@
+#include "merenje.hpp"
+
+#include "../Cons/afin.hpp"
+
+// Konstrukcija translacije
+MERENJE("geom::trans", [](merenje::stanje& s){
+    auto x = 1.0;
+
+    while (s.dalje()){
+        merenje::zadrzi(geom::trans(x, 2));
+        x += 1e-9;
+    }
+});
+
+// Konstrukcija skaliranja oko tacke
+MERENJE("geom::skal", [](merenje::stanje& s){
+    auto x = 1.0;
+
+    while (s.dalje()){
+        merenje::zadrzi(geom::skal(x, 2, 3, 4));
+        x += 1e-9;
+    }
+});
+
+// Konstrukcija smicanja oko tacke
+MERENJE("geom::smic", [](merenje::stanje& s){
+    auto x = 0.5;
+
+    while (s.dalje()){
+        merenje::zadrzi(geom::smic(x, 0.2, 3, 4));
+        x += 1e-9;
+    }
+});
+
+// Konstrukcija rotacije oko tacke
+MERENJE("geom::rot", [](merenje::stanje& s){
+    auto u = 30.0;
+
+    while (s.dalje()){
+        merenje::zadrzi(geom::rot(u, 3, 4));
+        u += 1e-9;
+    }
+});
+
+// Konstrukcija refleksije oko tacke
+MERENJE("geom::refl", [](merenje::stanje& s){
+    auto u = 30.0;
+
+    while (s.dalje()){
+        merenje::zadrzi(geom::refl(u, 3, 4));
+        u += 1e-9;
+    }
+});
@@ -0,0 +1,32 @@
+#include "merenje.hpp"
+
+#include "../Cons/afin.hpp"
+
+// Inverz preslikavanja
+MERENJE("geom::inv", [](merenje::stanje& s){
+    auto g = geom::rot(30, 1, 2) * geom::skal(2, 3);
+
+    while (s.dalje()){
+        merenje::zadrzi(g.inv());
+    }
+});
+
+// Proizvod preslikavanja
+MERENJE("geom::operator*", [](merenje::stanje& s){
+    const auto a = geom::rot(30, 1, 2);
+    const auto b = geom::skal(2, 3, -1, 4);
+
+    while (s.dalje()){
+        merenje::zadrzi(a * b);
+    }
+});
+
+// Stepen preslikavanja
+MERENJE("geom::operator^", [](merenje::stanje& s){
+    const auto g = geom::rot(1, 1, 2);
+    const auto n = static_cast<int>(s.n());
+
+    while (s.dalje()){
+        merenje::zadrzi(g ^ n);
+    }
+}, 2, 16, 256, 4096);
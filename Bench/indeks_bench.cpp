@@ -0,0 +1,117 @@
+#include <memory>
+
+#include "merenje.hpp"
+#include "podaci.hpp"
+
+#include "../Cons/indeks.hpp"
+
+namespace {
+
+// Scena od n trouglova oko nasumicnih tacaka
+std::vector<std::unique_ptr<geom::poly>> scena(const merenje::Velicina n)
+{
+    std::vector<std::unique_ptr<geom::poly>> rez;
+    rez.reserve(n);
+    for (const auto& t : merenje::tacke(n)){
+        const auto x = 100*t[0], y = 100*t[1];
+        rez.push_back(std::make_unique<geom::poly>(
+            geom::NizTacaka{{x, y}, {x + 1, y}, {x, y + 1}}));
+    }
+
+    return rez;
+}
+
+// Pokazivaci na oblike scene
+std::vector<const geom::oblik*> pokazivaci(const std::vector<std::unique_ptr<geom::poly>>& s)
+{
+    std::vector<const geom::oblik*> rez;
+    rez.reserve(std::size(s));
+    for (const auto& o : s){
+        rez.push_back(o.get());
+    }
+
+    return rez;
+}
+
+}
+
+// Pakovanje indeksa
+MERENJE("indeks::napuni", [](merenje::stanje& s){
+    const auto oblici = scena(s.n());
+    const auto niz = pokazivaci(oblici);
+    geom::indeks ind;
+
+    while (s.dalje()){
+        ind.napuni(niz);
+        merenje::zadrzi(ind.size());
+    }
+
+    s.stavke(s.n());
+}, 1 << 16, 1 << 20);
+
+// Pogadjanje oblika tackom
+MERENJE("indeks::trazi/tacka", [](merenje::stanje& s){
+    const auto oblici = scena(s.n());
+    const geom::indeks ind(pokazivaci(oblici));
+    const auto upiti = merenje::tacke(1 << 10);
+
+    while (s.dalje()){
+        for (const auto& t : upiti){
+            merenje::zadrzi(ind.trazi(geom::tacka(100*t[0], 100*t[1])).size());
+        }
+    }
+
+    s.stavke(std::size(upiti));
+}, 1 << 16, 1 << 20);
+
+// Odsecanje vidljivog dela, prozor
+// velicine oko hiljaditog dela scene
+MERENJE("indeks::trazi/prozor", [](merenje::stanje& s){
+    const auto oblici = scena(s.n());
+    const geom::indeks ind(pokazivaci(oblici));
+    const auto upiti = merenje::tacke(1 << 10);
+
+    while (s.dalje()){
+        for (const auto& t : upiti){
+            geom::Okvir prozor;
+            prozor.prosiri(100*t[0], 100*t[1]);
+            prozor.prosiri(100*t[0] + 800, 100*t[1] + 800);
+            merenje::zadrzi(ind.trazi(prozor).size());
+        }
+    }
+
+    s.stavke(std::size(upiti));
+}, 1 << 16, 1 << 20);
+
+// Najblizi oblik tacki
+MERENJE("indeks::najblizi", [](merenje::stanje& s){
+    const auto oblici = scena(s.n());
+    const geom::indeks ind(pokazivaci(oblici));
+    const auto upiti = merenje::tacke(1 << 10);
+
+    while (s.dalje()){
+        for (const auto& t : upiti){
+            merenje::zadrzi(ind.najblizi(geom::tacka(100*t[0], 100*t[1])).front());
+        }
+    }
+
+    s.stavke(std::size(upiti));
+}, 1 << 16, 1 << 20);
+
+// Dodavanje i uklanjanje pojedinacnih oblika
+MERENJE("indeks::dodaj/ukloni", [](merenje::stanje& s){
+    const auto oblici = scena(s.n());
+    const auto niz = pokazivaci(oblici);
+    geom::indeks ind(niz);
+
+    while (s.dalje()){
+        for (merenje::Velicina i = 0; i < 1024; i++){
+            ind.ukloni(niz[i]);
+        }
+        for (merenje::Velicina i = 0; i < 1024; i++){
+            ind.dodaj(niz[i]);
+        }
+    }
+
+    s.stavke(2048);
+}, 1 << 16, 1 << 20);
@@ -0,0 +1,22 @@
+#include "merenje.hpp"
+
+#include "../Cons/jezgro.hpp"
+
+// Glavna fja; pored rezultata, u kontekst
+// se belezi i skup instrukcija jezgra, jer
+// od njega zavisi brzina primene transformacija
+int main(int argc, char* argv[])
+{
+    switch (geom::instrukcije()){
+    case geom::Instrukcije::avx2:
+        merenje::kontekst("instrukcije", "avx2");
+        break;
+    case geom::Instrukcije::sse2:
+        merenje::kontekst("instrukcije", "sse2");
+        break;
+    default:
+        merenje::kontekst("instrukcije", "skalarne");
+    }
+
+    return merenje::pokreni(argc, argv);
+}
@@ -0,0 +1,655 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+
+#include "merenje.hpp"
+
+// Imenski prostor za merenje performansi;
+// u ovoj datoteci je okruzenje za merenje
+namespace merenje {
+
+namespace {
+
+// Jedno registrovano merenje za
+// jednu konkretnu velicinu ulaza
+struct Merenje
+{
+    std::string ime;
+    Fja fja;
+    Velicina n;
+};
+
+// Rezultat jednog merenja
+struct Rezultat
+{
+    std::string ime;
+    Velicina iteracija;
+    double realno;
+    double procesorsko;
+    Velicina stavki;
+};
+
+// Zbirni pokazatelji ponovljenih merenja
+// jednog istog posla, u ns po ponavljanju
+struct Zbir
+{
+    double srednja;
+    double medijana;
+    double odstupanje;
+    double cv;
+};
+
+// Vrednost iz osnove za poredjenje
+struct Osnova
+{
+    double medijana = 0;
+    double cv = 0;
+};
+
+// Sva registrovana merenja; staticki objekat
+// unutar fje, kako ne bi zavisilo od redosleda
+// inicijalizacije razlicitih datoteka
+std::vector<Merenje>& merenja()
+{
+    static std::vector<Merenje> m;
+    return m;
+}
+
+// Dodatne informacije o okruzenju
+std::vector<std::pair<std::string, std::string>>& okruzenje()
+{
+    static std::vector<std::pair<std::string, std::string>> o;
+    return o;
+}
+
+// Najveci broj ponavljanja jednog merenja
+constexpr Velicina max_iteracija = 1'000'000'000;
+
+// Izvrsavanje jednog merenja; broj ponavljanja
+// se povecava dok ukupno vreme ne predje zadato
+// minimalno, kako bi izmereno vreme bilo pouzdano
+Rezultat izmeri(const Merenje& m, const double min_vreme)
+{
+    Velicina iteracija = 1;
+    while (true){
+        stanje s(m.n, iteracija);
+        m.fja(s);
+
+        // Dovoljno dugo merenje ili previse ponavljanja
+        if (s.realno() >= min_vreme || iteracija >= max_iteracija){
+            return {m.ime, iteracija, s.realno(), s.procesorsko(), s.stavki()};
+        }
+
+        // Procena potrebnog broja ponavljanja, uz malu
+        // rezervu, ali ne vise od deset puta odjednom
+        const auto faktor = s.realno() > 0 ? 1.4 * min_vreme / s.realno() : 10.0;
+        const auto sledece = static_cast<double>(iteracija) *
+                             std::clamp(faktor, 2.0, 10.0);
+        iteracija = static_cast<Velicina>(std::min(sledece,
+                                          static_cast<double>(max_iteracija)));
+    }
+}
+
+// Vreme po ponavljanju u nanosekundama
+double ns(const double vreme, const Velicina iteracija)
+{
+    return vreme * 1e9 / static_cast<double>(iteracija);
+}
+
+// Broj stavki u sekundi
+double propusnost(const Rezultat& r)
+{
+    return r.realno > 0 ? static_cast<double>(r.stavki * r.iteracija) / r.realno : 0;
+}
+
+// Zbirni pokazatelji niza vremena; koeficijent
+// varijacije (cv) je odnos standardnog odstupanja
+// i srednje vrednosti, tj. relativni sum merenja
+Zbir zbir(std::vector<double> vremena)
+{
+    const auto n = static_cast<double>(std::size(vremena));
+
+    const auto srednja = std::accumulate(std::cbegin(vremena),
+                                         std::cend(vremena), 0.0) / n;
+
+    auto kvadrati = 0.0;
+    for (const auto x : vremena){
+        kvadrati += (x - srednja) * (x - srednja);
+    }
+    const auto odstupanje = n > 1 ? std::sqrt(kvadrati / (n - 1)) : 0.0;
+
+    std::sort(std::begin(vremena), std::end(vremena));
+    const auto pola = std::size(vremena) / 2;
+    const auto medijana = std::size(vremena) % 2 ? vremena[pola]
+                                                 : (vremena[pola-1] + vremena[pola]) / 2;
+
+    return {srednja, medijana, odstupanje, srednja > 0 ? odstupanje / srednja : 0};
+}
+
+// Zbir realnih vremena ponovljenih merenja
+Zbir realno(const std::vector<Rezultat>& ponovljeni)
+{
+    std::vector<double> vremena;
+    for (const auto& r : ponovljeni){
+        vremena.push_back(ns(r.realno, r.iteracija));
+    }
+
+    return zbir(vremena);
+}
+
+// Zbir procesorskih vremena ponovljenih merenja
+Zbir procesorsko(const std::vector<Rezultat>& ponovljeni)
+{
+    std::vector<double> vremena;
+    for (const auto& r : ponovljeni){
+        vremena.push_back(ns(r.procesorsko, r.iteracija));
+    }
+
+    return zbir(vremena);
+}
+
+// Niska sa navodnicima za JSON
+std::string niska(const std::string& s)
+{
+    std::string rez = "\"";
+    for (const auto c : s){
+        if (c == '"' || c == '\\'){
+            rez += '\\';
+        }
+        rez += c;
+    }
+    return rez + "\"";
+}
+
+// Trenutni datum i vreme
+std::string datum()
+{
+    const auto sada = std::time(nullptr);
+    char bafer[32];
+    std::strftime(bafer, sizeof bafer, "%Y-%m-%dT%H:%M:%S", std::localtime(&sada));
+    return bafer;
+}
+
+// Ispis jednog unosa u nizu rezultata
+void unos(std::ostream& out, bool& prvi, const std::string& ime,
+          const std::string& dodatak, const double realno, const double procesorsko)
+{
+    out << (prvi ? "\n" : ",\n")
+        << "    {\n"
+        << "      \"name\": " << niska(ime) << ",\n"
+        << dodatak
+        << "      \"real_time\": " << realno << ",\n"
+        << "      \"cpu_time\": " << procesorsko << ",\n"
+        << "      \"time_unit\": \"ns\"";
+    prvi = false;
+}
+
+// Ispis rezultata u JSON formatu, istih
+// naziva polja kao kod Google Benchmark; ako
+// je merenje ponovljeno, posle pojedinacnih
+// rezultata slede i zbirni (mean, median,
+// stddev i cv, gde je cv relativan, a ne u ns)
+void json(std::ostream& out, const std::vector<std::vector<Rezultat>>& grupe)
+{
+    out << "{\n"
+        << "  \"context\": {\n"
+        << "    \"date\": " << niska(datum()) << ",\n"
+        << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+    for (const auto& [kljuc, vrednost] : okruzenje()){
+        out << "    " << niska(kljuc) << ": " << niska(vrednost) << ",\n";
+    }
+#ifdef NDEBUG
+    out << "    \"library_build_type\": \"release\"\n";
+#else
+    out << "    \"library_build_type\": \"debug\"\n";
+#endif
+    out << "  },\n"
+        << "  \"benchmarks\": [";
+
+    auto prvi = true;
+    for (const auto& ponovljeni : grupe){
+        const auto vise = std::size(ponovljeni) > 1;
+
+        // Pojedinacni rezultati
+        for (Velicina i = 0; i < std::size(ponovljeni); i++){
+            const auto& r = ponovljeni[i];
+
+            std::ostringstream dodatak;
+            if (vise){
+                dodatak << "      \"run_type\": \"iteration\",\n"
+                        << "      \"repetitions\": " << std::size(ponovljeni) << ",\n"
+                        << "      \"repetition_index\": " << i << ",\n";
+            }
+            dodatak << "      \"iterations\": " << r.iteracija << ",\n";
+
+            unos(out, prvi, r.ime, dodatak.str(),
+                 ns(r.realno, r.iteracija), ns(r.procesorsko, r.iteracija));
+            if (r.stavki){
+                out << ",\n      \"items_per_second\": " << propusnost(r);
+            }
+            out << "\n    }";
+        }
+
+        // Zbirni rezultati
+        if (vise){
+            const auto& ime = ponovljeni.front().ime;
+            const auto z = realno(ponovljeni);
+            const auto c = procesorsko(ponovljeni);
+            const std::tuple<const char*, double, double> zbirovi[] = {
+                {"mean", z.srednja, c.srednja},
+                {"median", z.medijana, c.medijana},
+                {"stddev", z.odstupanje, c.odstupanje},
+                {"cv", z.cv, c.cv}};
+
+            for (const auto& [naziv, r, p] : zbirovi){
+                unos(out, prvi, ime + "_" + naziv,
+                     "      \"run_type\": \"aggregate\",\n"
+                     "      \"aggregate_name\": \"" + std::string(naziv) + "\",\n",
+                     r, p);
+                out << "\n    }";
+            }
+        }
+    }
+
+    out << "\n  ]\n}\n";
+}
+
+// Ispis jednog rezultata u obliku tabele
+void konzola(std::ostream& out, const Rezultat& r)
+{
+    out << std::left << std::setw(40) << r.ime << std::right
+        << std::setw(14) << std::fixed << std::setprecision(1)
+        << ns(r.realno, r.iteracija) << " ns"
+        << std::setw(14) << ns(r.procesorsko, r.iteracija) << " ns"
+        << std::setw(12) << r.iteracija;
+    if (r.stavki){
+        out << std::setw(14) << std::setprecision(3)
+            << propusnost(r) / 1e6 << " M/s";
+    }
+    out << std::endl;
+}
+
+// Ispis zbira ponovljenih merenja u obliku
+// tabele; umesto broja iteracija je sum
+void konzola(std::ostream& out, const std::vector<Rezultat>& ponovljeni)
+{
+    if (std::size(ponovljeni) == 1){
+        konzola(out, ponovljeni.front());
+        return;
+    }
+
+    const auto z = realno(ponovljeni);
+    const auto c = procesorsko(ponovljeni);
+    out << std::left << std::setw(40) << ponovljeni.front().ime + "_median" << std::right
+        << std::setw(14) << std::fixed << std::setprecision(1) << z.medijana << " ns"
+        << std::setw(14) << c.medijana << " ns"
+        << std::setw(10) << std::setprecision(2) << z.cv * 100 << " %"
+        << std::endl;
+}
+
+// Citanje osnove za poredjenje iz JSON datoteke
+// koju je ranije napisao ovaj isti program; kao
+// vrednost se uzima medijana, a ako merenje nije
+// bilo ponovljeno, onda jedini rezultat
+std::map<std::string, Osnova> osnova(std::istream& in)
+{
+    std::stringstream sadrzaj;
+    sadrzaj << in.rdbuf();
+    const auto tekst = sadrzaj.str();
+
+    // Polja niza rezultata su ravni objekti,
+    // bez ugnjezdavanja, pa je dovoljan izraz
+    const std::regex objekat(R"(\{[^{}]*\})");
+    const std::regex polje(R"re("(\w+)"\s*:\s*("((?:[^"\\]|\\.)*)"|[-+0-9.eE]+))re");
+
+    std::map<std::string, Osnova> rez;
+    const auto pocetak = tekst.find("\"benchmarks\"");
+    if (pocetak == std::string::npos){
+        throw std::runtime_error("Datoteka nema niz rezultata!");
+    }
+
+    for (std::sregex_iterator it(std::cbegin(tekst) + pocetak, std::cend(tekst), objekat), kraj;
+         it != kraj; ++it){
+        // Citanje polja objekta
+        std::map<std::string, std::string> polja;
+        const auto o = it->str();
+        for (std::sregex_iterator p(std::cbegin(o), std::cend(o), polje); p != kraj; ++p){
+            polja[(*p)[1]] = (*p)[3].matched ? (*p)[3].str() : (*p)[2].str();
+        }
+
+        if (!polja.count("name") || !polja.count("real_time")){
+            continue;
+        }
+
+        auto ime = polja["name"];
+        const auto vreme = std::stod(polja["real_time"]);
+        const auto zbirni = polja["run_type"] == "aggregate";
+        const auto naziv = polja["aggregate_name"];
+
+        if (zbirni){
+            ime.erase(ime.rfind('_'));
+        }
+
+        if (zbirni && naziv == "median"){
+            rez[ime].medijana = vreme;
+        } else if (zbirni && naziv == "cv"){
+            rez[ime].cv = vreme;
+        } else if (!zbirni && polja.count("repetitions") == 0){
+            rez[ime].medijana = vreme;
+        }
+    }
+
+    return rez;
+}
+
+// Poredjenje sa osnovom; merenje je nazadovalo ako
+// je medijana sporija od osnove za vise od praga,
+// ali samo ako je sum (veci od dva cv) manji od
+// polovine praga, jer se inace promena ne moze
+// razlikovati od slucajnosti; merenja kojih nema
+// u osnovi se samo prijavljuju, da se ne bi tiho
+// preskocila; vraca broj nazadovanja
+Velicina uporedi(std::ostream& out, const std::map<std::string, Osnova>& osnove,
+                 const std::vector<std::vector<Rezultat>>& grupe, const double prag)
+{
+    out << std::endl
+        << std::left << std::setw(40) << "Poredjenje sa osnovom" << std::right
+        << std::setw(15) << "Osnova"
+        << std::setw(15) << "Sada"
+        << std::setw(11) << "Promena"
+        << std::setw(9) << "Sum"
+        << "  Status" << std::endl
+        << std::string(100, '-') << std::endl;
+
+    Velicina nazadovanja = 0;
+    for (const auto& ponovljeni : grupe){
+        const auto& ime = ponovljeni.front().ime;
+        const auto it = osnove.find(ime);
+        const auto z = realno(ponovljeni);
+        if (it == std::cend(osnove) || it->second.medijana <= 0){
+            out << std::left << std::setw(40) << ime << std::right << std::fixed
+                << std::setw(15) << "-"
+                << std::setw(12) << std::setprecision(1) << z.medijana << " ns"
+                << std::setw(11) << "-"
+                << std::setw(9) << "-"
+                << "  nema u osnovi" << std::endl;
+            continue;
+        }
+
+        const auto promena = z.medijana / it->second.medijana - 1;
+        const auto sum = std::max(z.cv, it->second.cv);
+
+        const char* status;
+        if (sum > prag / 2){
+            status = "bucno";
+        } else if (promena > prag){
+            status = "NAZADOVANJE";
+            nazadovanja++;
+        } else if (promena < -prag){
+            status = "ubrzanje";
+        } else {
+            status = "u redu";
+        }
+
+        out << std::left << std::setw(40) << ime << std::right << std::fixed
+            << std::setw(12) << std::setprecision(1) << it->second.medijana << " ns"
+            << std::setw(12) << z.medijana << " ns"
+            << std::setw(9) << std::showpos << promena * 100 << std::noshowpos << " %"
+            << std::setw(7) << sum * 100 << " %"
+            << "  " << status << std::endl;
+    }
+
+    return nazadovanja;
+}
+
+// Uputstvo za upotrebu
+void uputstvo(std::ostream& out, const char* program)
+{
+    out << "Upotreba: " << program << " [opcije]\n"
+        << "  --filter=<regex>      samo merenja ciji naziv odgovara\n"
+        << "  --min_vreme=<s>       najkrace trajanje merenja (0.5)\n"
+        << "  --format=konzola|json format standardnog izlaza\n"
+        << "  --izlaz=<datoteka>    upis rezultata u JSON datoteku\n"
+        << "  --ponavljanja=<n>     broj ponavljanja svakog merenja (1)\n"
+        << "  --osnova=<datoteka>   poredjenje sa ranije upisanim rezultatima\n"
+        << "  --prag=<procenat>     dozvoljeno usporenje u odnosu na osnovu (10)\n"
+        << "Izlazni kod je 2 ako neko merenje nazaduje, a 1 u slucaju greske.\n";
+}
+
+}
+
+// Konstruktor stanja
+stanje::stanje(const Velicina n, const Velicina iteracija)
+    : _n(n), _iteracija(iteracija), _preostalo(iteracija)
+{}
+
+// Dohvatac za velicinu ulaza
+Velicina stanje::n() const
+{
+    return _n;
+}
+
+// Uslov petlje merenja
+bool stanje::dalje()
+{
+    // Prvi poziv pokrece merenje
+    if (!_radi && _preostalo == _iteracija){
+        nastavi();
+    }
+
+    // Nastavljanje dok ima ponavljanja
+    if (_preostalo > 0){
+        _preostalo--;
+        return true;
+    }
+
+    // Poslednji poziv zaustavlja merenje
+    pauziraj();
+    return false;
+}
+
+// Privremeno zaustavljanje merenja
+void stanje::pauziraj()
+{
+    if (_radi){
+        _realno += std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - _start).count();
+        _procesorsko += static_cast<double>(std::clock() - _cpu_start) / CLOCKS_PER_SEC;
+        _radi = false;
+    }
+}
+
+// Nastavljanje merenja
+void stanje::nastavi()
+{
+    if (!_radi){
+        _radi = true;
+        _cpu_start = std::clock();
+        _start = std::chrono::steady_clock::now();
+    }
+}
+
+// Broj obradjenih stavki po ponavljanju
+void stanje::stavke(const Velicina n)
+{
+    _stavki = n;
+}
+
+// Dohvatac za broj ponavljanja
+Velicina stanje::iteracija() const
+{
+    return _iteracija;
+}
+
+// Dohvatac za realno vreme
+double stanje::realno() const
+{
+    return _realno;
+}
+
+// Dohvatac za procesorsko vreme
+double stanje::procesorsko() const
+{
+    return _procesorsko;
+}
+
+// Dohvatac za broj stavki
+Velicina stanje::stavki() const
+{
+    return _stavki;
+}
+
+// Registracija merenja za sve velicine ulaza;
+// ime svakog je oblika naziv/velicina, osim
+// ako velicine nisu ni zadate
+registracija::registracija(const std::string& ime, Fja fja,
+                           std::initializer_list<Velicina> velicine)
+{
+    // Merenje bez velicine ulaza
+    if (velicine.size() == 0){
+        merenja().push_back({ime, fja, 0});
+    }
+
+    for (const auto n : velicine){
+        merenja().push_back({ime + "/" + std::to_string(n), fja, n});
+    }
+}
+
+// Dodavanje informacije o okruzenju
+void kontekst(const std::string& kljuc, const std::string& vrednost)
+{
+    okruzenje().emplace_back(kljuc, vrednost);
+}
+
+// Pokretanje svih registrovanih merenja
+int pokreni(int argc, char* argv[])
+{
+    // Podrazumevana podesavanja
+    std::regex filter(".*");
+    auto min_vreme = 0.5;
+    auto format = std::string("konzola");
+    std::string izlaz;
+    Velicina ponavljanja = 1;
+    std::string osnova_datoteka;
+    auto prag = 0.1;
+
+    // Citanje argumenata komandne linije
+    for (auto i = 1; i < argc; i++){
+        const std::string arg = argv[i];
+        const auto jednako = arg.find('=');
+        const auto opcija = arg.substr(0, jednako);
+        const auto vrednost = jednako == std::string::npos ? "" : arg.substr(jednako+1);
+
+        try{
+            if (opcija == "--filter"){
+                filter = std::regex(vrednost);
+            } else if (opcija == "--min_vreme"){
+                min_vreme = std::stod(vrednost);
+            } else if (opcija == "--format" && (vrednost == "konzola" || vrednost == "json")){
+                format = vrednost;
+            } else if (opcija == "--izlaz" && !vrednost.empty()){
+                izlaz = vrednost;
+            } else if (opcija == "--ponavljanja" && std::stoul(vrednost) > 0){
+                ponavljanja = std::stoul(vrednost);
+            } else if (opcija == "--osnova" && !vrednost.empty()){
+                osnova_datoteka = vrednost;
+            } else if (opcija == "--prag" && std::stod(vrednost) >= 0){
+                prag = std::stod(vrednost) / 100;
+            } else {
+                uputstvo(std::cerr, argv[0]);
+                return opcija == "--help" ? 0 : 1;
+            }
+        } catch (std::exception&){
+            std::cerr << "Neispravna vrednost opcije " << opcija << "!" << std::endl;
+            return 1;
+        }
+    }
+
+    // Citanje osnove pre merenja, kako bi
+    // se greska prijavila sto pre
+    std::map<std::string, Osnova> osnove;
+    if (!osnova_datoteka.empty()){
+        std::ifstream datoteka(osnova_datoteka);
+        if (!datoteka){
+            std::cerr << "Neuspesno citanje " << osnova_datoteka << "!" << std::endl;
+            return 1;
+        }
+
+        try{
+            osnove = osnova(datoteka);
+        } catch (std::exception& e){
+            std::cerr << osnova_datoteka << ": " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    // Zaglavlje tabele
+    if (format == "konzola"){
+        std::cout << std::left << std::setw(40) << "Merenje" << std::right
+                  << std::setw(17) << "Vreme"
+                  << std::setw(17) << "CPU"
+                  << std::setw(12) << (ponavljanja > 1 ? "Sum" : "Iteracija")
+                  << std::setw(18) << "Propusnost" << std::endl
+                  << std::string(104, '-') << std::endl;
+    }
+
+    // Izvrsavanje merenja koja odgovaraju filteru
+    std::vector<std::vector<Rezultat>> grupe;
+    for (const auto& m : merenja()){
+        if (!std::regex_search(m.ime, filter)){
+            continue;
+        }
+
+        grupe.emplace_back();
+        for (Velicina i = 0; i < ponavljanja; i++){
+            grupe.back().push_back(izmeri(m, min_vreme));
+        }
+
+        if (format == "konzola"){
+            konzola(std::cout, grupe.back());
+        }
+    }
+
+    // Ispis u JSON formatu
+    if (format == "json"){
+        json(std::cout, grupe);
+    }
+
+    // Upis u datoteku
+    if (!izlaz.empty()){
+        std::ofstream datoteka(izlaz);
+        json(datoteka, grupe);
+
+        if (!datoteka){
+            std::cerr << "Neuspesan upis u " << izlaz << "!" << std::endl;
+            return 1;
+        }
+    }
+
+    // Poredjenje sa osnovom; izvestaj ide na
+    // standardni izlaz za greske ako je na
+    // standardnom izlazu JSON
+    if (!osnova_datoteka.empty()){
+        auto& out = format == "json" ? std::cerr : std::cout;
+        const auto nazadovanja = uporedi(out, osnove, grupe, prag);
+
+        if (nazadovanja){
+            out << std::endl << "Broj nazadovanja: " << nazadovanja << std::endl;
+            return 2;
+        }
+    }
+
+    return 0;
+}
+
+}
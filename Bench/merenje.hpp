@@ -0,0 +1,117 @@
+#ifndef MERENJE_HPP
+#define MERENJE_HPP
+
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+// Imenski prostor za merenje performansi; po
+// uzoru na Google Benchmark, svako merenje je
+// fja koja u petlji ponavlja meren posao, dok
+// okruzenje bira broj ponavljanja i meri vreme
+namespace merenje {
+
+// Alijas za velicine
+using Velicina = std::size_t;
+
+// Stanje jednog merenja; fja merenja pita
+// stanje da li treba da nastavi, a sve sto
+// se desi pre prvog pitanja ne meri se
+class stanje
+{
+public:
+    // Konstruktor sa velicinom ulaza
+    // i zeljenim brojem ponavljanja
+    stanje(const Velicina, const Velicina);
+
+    // Dohvatac za velicinu ulaza
+    Velicina n() const;
+
+    // Uslov petlje merenja; prvi poziv
+    // pokrece, a poslednji zaustavlja stopericu
+    bool dalje();
+
+    // Privremeno zaustavljanje i nastavljanje
+    // merenja, npr. zbog pripreme ulaza
+    void pauziraj();
+    void nastavi();
+
+    // Broj obradjenih stavki po ponavljanju,
+    // radi racunanja propusnosti
+    void stavke(const Velicina);
+
+    // Dohvataci za rezultate merenja
+    Velicina iteracija() const;
+    double realno() const;
+    double procesorsko() const;
+    Velicina stavki() const;
+
+private:
+    // Velicina ulaza
+    Velicina _n;
+
+    // Zeljeni i preostali broj ponavljanja
+    Velicina _iteracija;
+    Velicina _preostalo;
+
+    // Pocetak tekuceg merenja
+    std::chrono::steady_clock::time_point _start;
+    std::clock_t _cpu_start = 0;
+
+    // Izmereno realno i procesorsko vreme u
+    // sekundama, kao i broj stavki po ponavljanju
+    double _realno = 0;
+    double _procesorsko = 0;
+    Velicina _stavki = 0;
+
+    // Indikator da je merenje u toku
+    bool _radi = false;
+};
+
+// Sprecavanje da prevodilac izbaci racun
+// ciji se rezultat inace nigde ne koristi
+template <typename T>
+inline void zadrzi(const T& x)
+{
+#ifdef __GNUC__
+    asm volatile("" : : "r,m"(x) : "memory");
+#else
+    static volatile const void* ponor;
+    ponor = &x;
+#endif
+}
+
+// Fja merenja
+using Fja = std::function<void(stanje&)>;
+
+// Registracija merenja za sve zadate velicine
+// ulaza; koristi se preko statickog objekta
+struct registracija
+{
+    registracija(const std::string&, Fja, std::initializer_list<Velicina>);
+};
+
+// Dodavanje informacije o okruzenju u
+// kontekst JSON izlaza, npr. skup instrukcija
+void kontekst(const std::string&, const std::string&);
+
+// Pokretanje svih registrovanih merenja
+// prema argumentima komandne linije
+int pokreni(int, char*[]);
+
+}
+
+// Makro za registraciju merenja, pa je moguce
+// pisati npr. MERENJE("util::mult", fja, 3, 8),
+// ili samo MERENJE("geom::inv", fja) ako merenje
+// ne zavisi od velicine ulaza
+#define MERENJE_SPOJ2(a, b) a##b
+#define MERENJE_SPOJ(a, b) MERENJE_SPOJ2(a, b)
+#define MERENJE(ime, fja, ...) \
+    static const merenje::registracija \
+    MERENJE_SPOJ(merenje_, __LINE__)(ime, fja, {__VA_ARGS__})
+
+#endif // MERENJE_HPP
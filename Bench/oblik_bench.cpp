@@ -0,0 +1,33 @@
+#include "merenje.hpp"
+#include "podaci.hpp"
+
+#include "../Cons/afin.hpp"
+
+// Transformacija oblika
+MERENJE("oblik::transformisi", [](merenje::stanje& s){
+    const auto g = geom::rot(30, 1, 2) * geom::skal(2, 3);
+    geom::poly p(merenje::tacke(s.n()));
+
+    while (s.dalje()){
+        p.transformisi(g);
+        merenje::zadrzi(p.tacke().front());
+    }
+
+    s.stavke(s.n());
+}, 1 << 10, 1 << 16, 1 << 20);
+
+// Konveksni omot oblika
+MERENJE("poly::omot", [](merenje::stanje& s){
+    const auto izvor = merenje::tacke(s.n());
+
+    while (s.dalje()){
+        s.pauziraj();
+        geom::poly p(izvor);
+        s.nastavi();
+
+        p.omot();
+        merenje::zadrzi(p.tacke().front());
+    }
+
+    s.stavke(s.n());
+}, 1 << 10, 1 << 16, 1 << 20);
@@ -0,0 +1,45 @@
+#ifndef PODACI_HPP
+#define PODACI_HPP
+
+#include <random>
+
+#include "../Cons/oblik.hpp"
+
+// Imenski prostor za merenje performansi
+namespace merenje {
+
+// Niz nasumicnih tacaka, uvek istih za istu
+// velicinu, kako bi merenja bila uporediva
+inline geom::NizTacaka tacke(const Velicina n)
+{
+    std::mt19937 gen(static_cast<std::mt19937::result_type>(n));
+    std::normal_distribution<> dis(0, 100);
+
+    geom::NizTacaka rez;
+    rez.reserve(n);
+    for (Velicina i = 0; i < n; i++){
+        rez.emplace_back(dis(gen), dis(gen));
+    }
+
+    return rez;
+}
+
+// Kvadratna matrica nasumicnih brojeva
+inline geom::Matrica matrica(const Velicina n)
+{
+    std::mt19937 gen(static_cast<std::mt19937::result_type>(n));
+    std::uniform_real_distribution<> dis(-1, 1);
+
+    geom::Matrica rez(n, geom::Vektor(n));
+    for (auto& red : rez){
+        for (auto& x : red){
+            x = dis(gen);
+        }
+    }
+
+    return rez;
+}
+
+}
+
+#endif // PODACI_HPP
@@ -0,0 +1,53 @@
+#include <sstream>
+
+#include "merenje.hpp"
+#include "podaci.hpp"
+
+#include "../Cons/scena.hpp"
+
+namespace {
+
+// Tekstualna scena od n poligona po 64 tacke
+std::string tekst(const merenje::Velicina n)
+{
+    const geom::poly p(merenje::tacke(64));
+
+    std::ostringstream out;
+    for (merenje::Velicina i = 0; i < n; i++){
+        geom::pisi_tekst(out, p);
+    }
+
+    return out.str();
+}
+
+}
+
+// Parsiranje tekstualne scene; stavke
+// su bajtovi, pa je propusnost u B/s
+MERENJE("scena::citaj_tekst", [](merenje::stanje& s){
+    const auto bafer = tekst(s.n());
+
+    while (s.dalje()){
+        geom::citaj_tekst(std::data(bafer), std::data(bafer) + std::size(bafer),
+                          [](std::unique_ptr<geom::oblik> o){
+            merenje::zadrzi(o->tacke().front());
+        });
+    }
+
+    s.stavke(std::size(bafer));
+}, 1 << 6, 1 << 12);
+
+// Upis tekstualne scene u punoj preciznosti
+MERENJE("scena::pisi_tekst", [](merenje::stanje& s){
+    const geom::poly p(merenje::tacke(64));
+
+    while (s.dalje()){
+        std::ostringstream out;
+        for (merenje::Velicina i = 0; i < s.n(); i++){
+            geom::pisi_tekst(out, p);
+        }
+        merenje::zadrzi(out.tellp());
+    }
+
+    s.stavke(s.n() * 64);
+}, 1 << 6, 1 << 12);
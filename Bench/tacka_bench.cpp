@@ -0,0 +1,38 @@
+#include "merenje.hpp"
+#include "podaci.hpp"
+
+#include "../Cons/afin.hpp"
+
+// Sabiranje tacaka
+MERENJE("tacka::operator+", [](merenje::stanje& s){
+    const geom::tacka a(1, 2);
+    const geom::tacka b(3, 4);
+
+    while (s.dalje()){
+        merenje::zadrzi(a + b);
+    }
+});
+
+// Mnozenje tacke brojem
+MERENJE("tacka::operator*", [](merenje::stanje& s){
+    const geom::tacka a(1, 2);
+
+    while (s.dalje()){
+        merenje::zadrzi(a * 1.5);
+    }
+});
+
+// Primena transformacije tacku po tacku
+MERENJE("tacka::primeni", [](merenje::stanje& s){
+    const auto g = geom::rot(30, 1, 2) * geom::skal(2, 3);
+    auto niz = merenje::tacke(s.n());
+
+    while (s.dalje()){
+        for (auto& t : niz){
+            t.primeni(g);
+        }
+        merenje::zadrzi(niz.front());
+    }
+
+    s.stavke(s.n());
+}, 1 << 10, 1 << 16, 1 << 20);
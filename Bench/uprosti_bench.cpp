@@ -0,0 +1,55 @@
+#include "merenje.hpp"
+#include "podaci.hpp"
+
+#include "../Cons/uprosti.hpp"
+
+namespace {
+
+// Nasumicna setnja od n temena, nalik obali
+geom::NizTacaka setnja(const merenje::Velicina n)
+{
+    geom::NizTacaka rez;
+    rez.reserve(n);
+    geom::Element x = 0, y = 0;
+    for (const auto& t : merenje::tacke(n)){
+        rez.emplace_back(x += t[0], y += t[1]);
+    }
+
+    return rez;
+}
+
+}
+
+// Douglas-Peucker uproscavanje
+MERENJE("douglas_peucker", [](merenje::stanje& s){
+    const auto t = setnja(s.n());
+
+    while (s.dalje()){
+        merenje::zadrzi(geom::douglas_peucker(t, 2).size());
+    }
+
+    s.stavke(s.n());
+}, 1 << 12, 1 << 16, 1 << 20);
+
+// Visvalingam-Whyatt uproscavanje
+MERENJE("visvalingam", [](merenje::stanje& s){
+    const auto t = setnja(s.n());
+
+    while (s.dalje()){
+        merenje::zadrzi(geom::visvalingam(t, 2).size());
+    }
+
+    s.stavke(s.n());
+}, 1 << 12, 1 << 16, 1 << 20);
+
+// Izdvajanje hiljadu najvaznijih temena; ne
+// zavisi od ukupnog broja temena linije
+MERENJE("nivoi_detalja::po_broju", [](merenje::stanje& s){
+    const geom::nivoi_detalja n(setnja(s.n()));
+
+    while (s.dalje()){
+        merenje::zadrzi(n.po_broju(1000).size());
+    }
+
+    s.stavke(1000);
+}, 1 << 12, 1 << 16, 1 << 20);
@@ -0,0 +1,77 @@
+#include "merenje.hpp"
+#include "podaci.hpp"
+
+#include "../Cons/afin.hpp"
+
+// Opste mnozenje kvadratnih matrica
+MERENJE("util::mult", [](merenje::stanje& s){
+    auto a = merenje::matrica(s.n());
+    auto b = merenje::matrica(s.n());
+
+    while (s.dalje()){
+        merenje::zadrzi(util::mult(a, b));
+    }
+}, 3, 8, 32, 128);
+
+// Mnozenje afinih koeficijenata
+MERENJE("util::mult_afin", [](merenje::stanje& s){
+    const auto a = geom::rot(30, 1, 2).koef();
+    const auto b = geom::skal(2, 3, -1, 4).koef();
+    geom::Koeficijenti c;
+
+    while (s.dalje()){
+        util::mult_afin(a, b, c);
+        merenje::zadrzi(c);
+    }
+});
+
+// Stepenovanje preslikavanja
+MERENJE("util::pow", [](merenje::stanje& s){
+    const geom::geom g = geom::rot(1, 1, 2);
+    const auto n = static_cast<int>(s.n());
+
+    while (s.dalje()){
+        merenje::zadrzi(util::pow(g, n));
+    }
+}, 2, 16, 256, 4096);
+
+// Stepenovanje afinih koeficijenata u mestu
+MERENJE("util::pow_afin", [](merenje::stanje& s){
+    const auto g = geom::rot(1, 1, 2).koef();
+    const auto n = static_cast<unsigned>(s.n());
+
+    while (s.dalje()){
+        auto k = g;
+        util::pow_afin(k, n);
+        merenje::zadrzi(k);
+    }
+}, 2, 16, 256, 4096);
+
+// Poredjenje kolekcija sa tolerancijom
+MERENJE("util::jednakost", [](merenje::stanje& s){
+    const auto a = merenje::matrica(s.n());
+    const auto b = a;
+
+    while (s.dalje()){
+        merenje::zadrzi(util::jednakost(a, b, 1e-5));
+    }
+
+    s.stavke(s.n()*s.n());
+}, 3, 8, 32, 128);
+
+// Konveksni omot nasumicnog oblaka tacaka;
+// ulaz se obnavlja van merenog vremena
+MERENJE("util::konv_omot", [](merenje::stanje& s){
+    const auto izvor = merenje::tacke(s.n());
+    auto niz = izvor;
+
+    while (s.dalje()){
+        merenje::zadrzi(util::konv_omot(std::begin(niz), std::end(niz)));
+
+        s.pauziraj();
+        niz = izvor;
+        s.nastavi();
+    }
+
+    s.stavke(s.n());
+}, 1 << 10, 1 << 16, 1 << 20);
@@ -6,14 +6,31 @@ CONFIG -= qt
 SOURCES += \
     afin.cpp \
     geom.cpp \
+    indeks.cpp \
+    jezgro.cpp \
+    lanac.cpp \
     main.cpp \
+    mapa.cpp \
+    mreza.cpp \
     oblik.cpp \
-    tacka.cpp
+    paralelno.cpp \
+    scena.cpp \
+    tacka.cpp \
+    uprosti.cpp
 
 HEADERS += \
     afin.hpp \
     alijasi.hpp \
     geom.hpp \
+    indeks.hpp \
+    jezgro.hpp \
+    lanac.hpp \
+    mapa.hpp \
+    mreza.hpp \
     oblik.hpp \
+    okvir.hpp \
+    paralelno.hpp \
+    scena.hpp \
     tacka.hpp \
+    uprosti.hpp \
     util.hpp
@@ -5,6 +5,26 @@
 // afine transformacije i povezano
 namespace geom {
 
+// Pomocne fje vidljive samo ovde
+namespace {
+
+// Linearno preslikavanje centrirano u tacki
+// (x, y) u zatvorenom obliku; umesto proizvoda
+// T(x, y) * L * T(-x, -y), koji trazi dva cela
+// mnozenja matrica, racuna se samo pomeraj:
+//     |a   b   x - (ax + by)|
+//     |d   e   y - (dx + ey)|
+//     |0   0         1      |
+Koeficijenti centrirano(const double a, const double b,
+                        const double d, const double e,
+                        const double x, const double y)
+{
+    return {a, b, x - (a*x + b*y),
+            d, e, y - (d*x + e*y)};
+}
+
+}
+
 // Translacija od koordinata
 trans::trans(double x, double y, const bool inv)
 {
@@ -17,10 +37,10 @@ trans::trans(double x, double y, const bool inv)
         y = -y;
     }
 
-    // Matrica translacije u ravni
-    _mat = {{1, 0, x},
-            {0, 1, y},
-            {0, 0, 1}};
+    // Matrica translacije u ravni; poslednji
+    // red {0, 0, 1} se podrazumeva i ne pise
+    _mat = {1, 0, x,
+            0, 1, y};
 }
 
 // Translacija od tacke
@@ -45,13 +65,10 @@ skal::skal(double x, double y, const double t1, const double t2, const bool inv)
         y = 1/y;
     }
 
-    // Matrica skaliranja u ravni
-    _mat = {{x, 0, 0},
-            {0, y, 0},
-            {0, 0, 1}};
-
-    // Eventualno centriranje preslikavanja
-    pomeri(t1, t2, true);
+    // Matrica skaliranja u ravni,
+    // centrirana u tacki (t1, t2)
+    _mat = centrirano(x, 0,
+                      0, y, t1, t2);
 }
 
 // Skaliranje od koordinata
@@ -89,13 +106,10 @@ smic::smic(double x, double y, const double t1, const double t2, const bool inv)
         y = -y;
     }
 
-    // Matrica smicanja u ravni
-    _mat = {{ f,  f*x, 0},
-            {f*y,  f,  0},
-            { 0,   0,  1}};
-
-    // Eventualno centriranje preslikavanja
-    pomeri(t1, t2, true);
+    // Matrica smicanja u ravni,
+    // centrirana u tacki (t1, t2)
+    _mat = centrirano( f,  f*x,
+                      f*y,  f,  t1, t2);
 }
 
 // Smicanje od koordinata
@@ -129,13 +143,10 @@ rot::rot(double u_deg, const double t1, const double t2, const bool inv)
     const auto pom1 = cos(util::deg2rad(u_deg));
     const auto pom2 = sin(util::deg2rad(u_deg));
 
-     // Matrica rotacije u ravni
-     _mat = {{pom1, -pom2,  0},
-             {pom2,  pom1,  0},
-             { 0,     0,    1}};
-
-     // Eventualno centriranje preslikavanja
-     pomeri(t1, t2, true);
+     // Matrica rotacije u ravni,
+     // centrirana u tacki (t1, t2)
+     _mat = centrirano(pom1, -pom2,
+                       pom2,  pom1,  t1, t2);
 }
 
 // Rotacija od ugla sa tackom
@@ -156,13 +167,10 @@ refl::refl(double u_deg, const double t1, const double t2, const bool)
     const auto pom1 = cos(util::deg2rad(2*u_deg));
     const auto pom2 = sin(util::deg2rad(2*u_deg));
 
-    // Matrica refleksije u ravni
-    _mat = {{pom1,  pom2,  0},
-            {pom2, -pom1,  0},
-            { 0,     0,    1}};
-
-    // Eventualno centriranje preslikavanja
-    pomeri(t1, t2, true);
+    // Matrica refleksije u ravni,
+    // centrirana u tacki (t1, t2)
+    _mat = centrirano(pom1,  pom2,
+                      pom2, -pom1,  t1, t2);
 }
 
 // Refleksija od ugla sa tackom
@@ -1,6 +1,9 @@
 #ifndef ALIJASI_HPP
 #define ALIJASI_HPP
 
+#include <vector>
+#include <array>
+
 #include "util.hpp"
 
 // Imenski prostor za geometriju
@@ -17,6 +20,15 @@ using Element = Vektor::value_type;
 using Velicina = Matrica::size_type;
 using NizTacaka = std::vector<tacka>;
 
+// Koeficijenti afinog preslikavanja, tj. prva
+// dva reda homogene matrice; treci red je uvek
+// {0, 0, 1}, pa se ne cuva vec se podrazumeva
+using Koeficijenti = std::array<Element, 6>;
+
+// Koordinate tacke afine ravni; homogena
+// koordinata je uvek 1, pa se ne cuva
+using Koordinate = std::array<Element, 2>;
+
 }
 
 #endif // ALIJASI_HPP
@@ -1,6 +1,7 @@
 #include <sstream>
 #include <iterator>
 #include <iomanip>
+#include <limits>
 
 #include "afin.hpp"
 
@@ -27,28 +28,42 @@ inline const char* Exc::what() const noexcept
     return poruka.c_str();
 }
 
+// Poslednji red svake afine matrice; ne
+// cuva se u objektu, vec samo ovde jednom
+static const Element poslednji_red[] = {0, 0, 1};
+
 // Konstruktor bez argumenata
 geom::geom()
-    : _mat({{1, 0, 0},
-            {0, 1, 0},
-            {0, 0, 1}})
+    : _mat({1, 0, 0,
+            0, 1, 0})
+{}
+
+// Konstruktor kopije sa semantikom pomeranja;
+// nema sta da se preuzme, pa se kopira, ali se
+// izvor prazni, kao sto bi bio i prazan vektor
+geom::geom(geom&& g) noexcept
+    : _mat(g._mat), _size(g._size), _tol(g._tol)
+{
+    g.isprazni();
+}
+
+// Konstruktor od koeficijenata
+geom::geom(const Koeficijenti& k)
+    : _mat(k)
 {}
 
 // Konstruktor od vektora kao l-vrednosti
 geom::geom(const Matrica& v)
-    : _mat(v)
 {
     // Provera korektnosti preslikavanja
-    proveri();
+    proveri(v);
 }
 
-// Konstruktor od vektora kao r-vrednosti
+// Konstruktor od vektora kao r-vrednosti;
+// prosledjena matrica se svakako prazni
 geom::geom(Matrica&& v)
-    : _mat(std::move(v))
-{
-    // Provera korektnosti preslikavanja
-    proveri();
-}
+    : geom(static_cast<const Matrica&>(Matrica(std::move(v))))
+{}
 
 // Konstruktor od vektorâ kao l-vrednosti;
 // ovaj se poziva i u mesanom slucaju, ako su
@@ -56,20 +71,14 @@ geom::geom(Matrica&& v)
 geom::geom(const Vektor& v1,
            const Vektor& v2,
            const Vektor& v3)
-    : _mat({v1, v2, v3})
-{
-    // Provera korektnosti preslikavanja
-    proveri();
-}
+    : geom(Matrica{v1, v2, v3})
+{}
 
 // Konstruktor od vektorâ kao r-vrednosti;
 // poziva se iskljucivo ako su sva tri desna
 geom::geom(Vektor&& v1, Vektor&& v2, Vektor&& v3)
-    : _mat({std::move(v1), std::move(v2), std::move(v3)})
-{
-    // Provera korektnosti preslikavanja
-    proveri();
-}
+    : geom(Matrica{std::move(v1), std::move(v2), std::move(v3)})
+{}
 
 // Konstruktor od dva l-vektora
 geom::geom(const Vektor& v1,
@@ -83,8 +92,21 @@ geom::geom(Vektor&& v1,
     : geom(std::move(v1), std::move(v2), {0, 0, 1})
 {}
 
-// Dohvatac (getter) za matricu
-const Matrica& geom::mat() const
+// Dohvatac (getter) za matricu; prazna
+// matrica u slucaju praznog preslikavanja
+Matrica geom::mat() const
+{
+    if (prazna()){
+        return {};
+    }
+
+    return {{_mat[0], _mat[1], _mat[2]},
+            {_mat[3], _mat[4], _mat[5]},
+            {   0,       0,       1   }};
+}
+
+// Dohvatac (getter) za koeficijente
+const Koeficijenti& geom::koef() const
 {
     return _mat;
 }
@@ -101,25 +123,25 @@ Element geom::tol() const
     return _tol;
 }
 
-// Kolekcijski metod za pocetak matrice
+// Kolekcijski metod za pocetak koeficijenata
 auto geom::begin() const noexcept
 {
     return std::begin(_mat);
 }
 
-// Kolekcijski metod za const pocetak matrice
+// Kolekcijski metod za const pocetak koeficijenata
 auto geom::cbegin() const noexcept
 {
     return std::cbegin(_mat);
 }
 
-// Kolekcijski metod za kraj matrice
+// Kolekcijski metod za kraj koeficijenata
 auto geom::end() const noexcept
 {
     return std::end(_mat);
 }
 
-// Kolekcijski metod za const kraj matrice
+// Kolekcijski metod za const kraj koeficijenata
 auto geom::cend() const noexcept
 {
     return std::cend(_mat);
@@ -137,9 +159,8 @@ geom geom::inv(const bool inplace)
 {
     // Izvlacenje vrednosti polja matrice
     // dekompozicijom privremene n-torke
-    const auto [a, b, c,
-                d, e, f] = std::tie(_mat[0][0], _mat[0][1], _mat[0][2],
-                                    _mat[1][0], _mat[1][1], _mat[1][2]);
+    const auto& [a, b, c,
+                 d, e, f] = _mat;
 
     // Nije moguce izracunati inverz
     // ukoliko je matrica singularna
@@ -153,9 +174,8 @@ geom geom::inv(const bool inplace)
     const auto t2 = c*d - a*f;
 
     // Racunanje rezultata
-    geom rez{{k*e, k*-b, k*t1},
-             {k*-d, k*a, k*t2},
-             {  0,   0,    1 }};
+    const geom rez(Koeficijenti{k*e, k*-b, k*t1,
+                                k*-d, k*a, k*t2});
 
     // Vracanje i izmena
     return inplace ? *this = rez : rez;
@@ -219,7 +239,7 @@ std::string geom::str() const
     // Prazno preslikavanje; moguce u slucaju
     // pomerenog (move) ili neispravnog, lose
     // inicijalizovanog ili izmenjenog objekta
-    if (_mat.empty()){
+    if (prazna()){
         return "[]";
     }
 
@@ -243,12 +263,13 @@ std::string geom::str() const
         }
 
         // Kopiranje reda na izlazni tok
+        const auto red = (*this)[i].red;
         niska << "[";
-        std::copy(std::cbegin(_mat[i]),
-                  std::cend(_mat[i])-1,
+        std::copy(red,
+                  red+_size-1,
                   // Iterator izlaznog toka sa separatorom
                   std::ostream_iterator<Element>(niska, ", "));
-        niska << _mat[i][_size-1];
+        niska << red[_size-1];
         niska << "]";
 
         // Novi red ako nije poslednji
@@ -264,10 +285,14 @@ std::string geom::str() const
     return niska.str();
 }
 
-// Operator mnozenja
+// Operator mnozenja; kako su oba cinioca
+// afina, koristi se specijalizovano mnozenje
+// koje preskace podrazumevani poslednji red
 geom geom::operator*(const geom& dr) const
 {
-    return util::mult(*this, dr);
+    Koeficijenti rez;
+    util::mult_afin(_mat, dr._mat, rez);
+    return geom(rez);
 }
 
 // Mnozenje numerickom vrednoscu zdesna
@@ -276,11 +301,12 @@ geom geom::operator*(const double broj) const
     return broj * *this;
 }
 
-// Operator mnozenja sa dodelom; ne cini
-// mi se da je moguca ikakva optimizacija
+// Operator mnozenja sa dodelom; mnozi
+// se u mestu, bez ikakve alokacije
 geom& geom::operator*=(const geom& dr)
 {
-    return *this = *this * dr;
+    util::mult_afin(_mat, dr._mat, _mat);
+    return *this;
 }
 
 // Mnozenje numerickom vrednoscu zdesna sa dodelom
@@ -295,16 +321,22 @@ geom& geom::operator*=(const double broj)
 // kog aritmetickog ili relacionog operatora, tako
 // da u upotrebi mora biti npr. a*(b^2), dok se a*b^2
 // tumaci kao (a*b)^2, sto bi vrv bilo neocekivano
-inline geom geom::operator^(const int i) const
+geom geom::operator^(const int i) const
 {
-    return util::pow(*this, i);
+    auto rez = *this;
+    return rez ^= i;
 }
 
-// Operator stepenovanja sa dodelom;
-// opet ne vidim mesto za doradu
+// Operator stepenovanja sa dodelom; stepenuje
+// se u mestu, a inverzija je potrebna samo
+// u slucaju negativnog polaznog stepena; apsolutna
+// vrednost se racuna neoznaceno, jer std::abs nije
+// definisan za najmanji int
 geom& geom::operator^=(const int i)
 {
-    return *this = *this ^ i;
+    const auto n = static_cast<unsigned>(i);
+    util::pow_afin(_mat, i < 0 ? 0u - n : n);
+    return i >= 0 ? *this : *this = inv();
 }
 
 // Operator jednakosti
@@ -314,6 +346,11 @@ bool geom::operator==(const geom& dr) const
     // na sitnu gresku u racunu
     //return _mat == dr._mat;
 
+    // Prazna su jednaka samo medjusobno
+    if (prazna() || dr.prazna()){
+        return prazna() && dr.prazna();
+    }
+
     return util::jednakost(_mat, dr._mat, _tol);
 }
 
@@ -323,13 +360,23 @@ bool geom::operator!=(const geom& dr) const
     return !(*this == dr);
 }
 
+// Operator dodele sa semantikom pomeranja
+geom& geom::operator=(geom&& g) noexcept
+{
+    _mat = g._mat;
+    _size = g._size;
+    _tol = g._tol;
+
+    g.isprazni();
+
+    return *this;
+}
+
 // Operator dodele l-vektora
 geom& geom::operator=(const Matrica& v)
 {
-    _mat = v;
-
     // Provera korektnosti preslikavanja
-    proveri();
+    proveri(v);
 
     return *this;
 }
@@ -337,22 +384,44 @@ geom& geom::operator=(const Matrica& v)
 // Operator dodele r-vektora
 geom& geom::operator=(Matrica&& v)
 {
-    _mat = std::move(v);
+    // Preuzimanje matrice, kako bi
+    // prosledjena svakako bila prazna
+    const auto m = std::move(v);
 
     // Provera korektnosti preslikavanja
-    proveri();
+    proveri(m);
 
     return *this;
 }
 
-// Operator indeksiranja za dohvatanje;
-// vraca referencu da ne bi bilo kopiranja;
-// briga o validnosti indeksa prepusta se
-// vektoru, koji se nalazi ispod omotaca;
+// Indeksiranje reda sa proverom granica;
 // menjanje nije dozovoljeno (const)
-const Vektor& geom::operator[](const Velicina i) const
+const Element& geom::Red::operator[](const Velicina j) const
 {
-    return _mat.at(i);
+    if (j >= 3){
+        throw std::out_of_range("Indeks kolone van granica!");
+    }
+
+    return red[j];
+}
+
+// Pretvaranje reda u vektor
+geom::Red::operator Vektor() const
+{
+    return {red[0], red[1], red[2]};
+}
+
+// Operator indeksiranja za dohvatanje; vraca
+// pogled na red da ne bi bilo kopiranja, dok
+// je poslednji red zajednicki za sve matrice;
+// menjanje nije dozovoljeno (const)
+const geom::Red geom::operator[](const Velicina i) const
+{
+    if (i >= _size){
+        throw std::out_of_range("Indeks reda van granica!");
+    }
+
+    return {i == _size-1 ? poslednji_red : &_mat[i*_size]};
 }
 
 // Struktura koja sluzi za citanje
@@ -366,22 +435,21 @@ geom::Citac geom::Citac::operator,(const Element x) const
 {
     // Provera indeksa
     if (i >= g._size*g._size){
-        g._mat.clear();
+        g.isprazni();
         throw Exc("Visak argumenata!");
     }
 
-    // Provera poslednjeg reda
+    // Provera poslednjeg reda, koji se ne upisuje
     if (i/g._size == g._size-1){
-        if ((i%g._size != g._size-1 && !util::jednakost(x, 0.0, g._tol)) ||
-            (i%g._size == g._size-1 && !util::jednakost(x, 1.0, g._tol))){
-            g._mat.clear();
+        if (!util::jednakost(x, poslednji_red[i%g._size], g._tol)){
+            g.isprazni();
             throw Exc("Poslednji red mora biti {0, 0, ..., 1}!");
         }
+    } else {
+        // Upis broja
+        g._mat[i] = x;
     }
 
-    // Upis broja
-    g._mat[i/g._size][i%g._size] = x;
-
     // Nastavljanje dalje
     return Citac(g, i+1);
 }
@@ -390,57 +458,70 @@ geom::Citac geom::Citac::operator,(const Element x) const
 geom::Citac geom::operator<<(const Element x)
 {
     // Upis broja
-    _mat[0][0] = x;
+    _mat[0] = x;
 
     // Nastavljanje dalje
     return Citac(*this, 1);
 }
 
 // Provera korektnosti preslikavanja
-void geom::proveri()
-{
-    if (std::size(_mat) == _size-1){
-        // Dodavanje homogenog dela ako fali
-        // na kopiran vec ucitani podvektor
-        Vektor mat;
-        std::fill_n(std::back_inserter(mat),
-                    _size-1,
-                    0);
-        mat.push_back(1);
-
-        // Preuzimanje implementacije
-        _mat.push_back(std::move(mat));
-    }
+void geom::proveri(const Matrica& v)
+{
+    // Dozvoljeno je izostavljanje
+    // homogenog, poslednjeg reda
+    const auto redova = std::size(v);
 
     // Izbacivanje izuzetka u slucaju
     // nekorektnog ulaznog vektora
-    if (std::size(_mat) != _size){
-        _mat.clear();
+    if (redova != _size && redova != _size-1){
+        isprazni();
         throw Exc("Vektor nije duzine " +
                   std::to_string(_size) + "!");
     }
 
     // U slucaju nekorektnih redova
-    for (Velicina i = 0; i < _size; i++){
-        if (std::size(_mat[i]) != _size){
-            _mat.clear();
+    for (Velicina i = 0; i < redova; i++){
+        if (std::size(v[i]) != _size){
+            isprazni();
             throw Exc("Podvektor " + std::to_string(i) +
                       " nije duzine " + std::to_string(_size) + "!");
         }
     }
 
     // U slucaju nekorektnog poslednjeg reda
-    if (!util::jednakost(std::vector<Element>{
-                         std::accumulate(std::cbegin(_mat[_size-1]),
-                                         std::cend(_mat[_size-1])-1,
-                                         0.0,
-                                         std::plus<>()),
-                         _mat[_size-1][_size-1]},
-                         std::vector<Element>{0, 1},
-                         _tol)){
-        _mat.clear();
-        throw Exc("Poslednji podvektor nije oblika {0, 0, ..., 1}!");
+    if (redova == _size){
+        proveri(v[_size-1].data());
     }
+
+    // Preuzimanje koeficijenata
+    _mat = {v[0][0], v[0][1], v[0][2],
+            v[1][0], v[1][1], v[1][2]};
+}
+
+// Provera poslednjeg reda preslikavanja;
+// jedina provera koja nije samo oblika
+void geom::proveri(const Element* red)
+{
+    for (Velicina j = 0; j < _size; j++){
+        if (!util::jednakost(red[j], poslednji_red[j], _tol)){
+            isprazni();
+            throw Exc("Poslednji podvektor nije oblika {0, 0, ..., 1}!");
+        }
+    }
+}
+
+// Praznjenje preslikavanja; obelezava se
+// vrednoscu koja nije broj (NaN), posto
+// takav koeficijent nema nikakvog smisla
+void geom::isprazni()
+{
+    _mat[0] = std::numeric_limits<Element>::quiet_NaN();
+}
+
+// Provera praznine preslikavanja
+bool geom::prazna() const
+{
+    return std::isnan(_mat[0]);
 }
 
 // Operator ispisa na izlazni tok
@@ -452,17 +533,28 @@ std::ostream& operator<<(std::ostream& out, const geom& g)
 // Operator citanja sa ulaznog toka
 std::istream& operator>>(std::istream& in, geom& g)
 {
-    // Kopiranje vrednosti sa ulaza
-    for (Velicina i = 0; i < g._size; i++){
-                    // Iterator ulaznog toka
-        std::copy_n(std::istream_iterator<Element>(in),
-                    g._size,
-                    std::begin(g._mat[i]));
+    // Ucitavanje koeficijenata i poslednjeg
+    // reda, bez privremene matrice; duzina
+    // reda je dimenzija matrice preslikavanja
+    Koeficijenti k;
+    Vektor red(g._size);
+    for (auto& x : k){
+        in >> x;
+    }
+    for (auto& x : red){
+        in >> x;
+    }
+
+    // Neuspesno citanje sa ulaza
+    if (!in){
+        g.isprazni();
+        return in;
     }
 
     // Provera korektnosti ulaza
     try{
-        g.proveri();
+        g.proveri(red.data());
+        g._mat = k;
     } catch (Exc&){
         in.setstate(std::ios::failbit);
     }
@@ -505,24 +597,22 @@ geom pomeri(geom& g, Vektor&& t, const bool inplace)
 geom operator*(const double broj, const geom& g)
 {
     // Inicijalizacija rezultata;
-    // on je matrica transformacije
-    auto rez = static_cast<Matrica>(g.mat());
-
-    // Mnozenje prvih redova
-    for (Velicina i = 0; i < std::size(rez)-1; i++){
-        std::transform(std::cbegin(rez[i]),
-                       std::cend(rez[i]),
-                       // Red = rezultat
-                       std::begin(rez[i]),
-                       // Mnozenje sleva
-                       std::bind(std::multiplies<>(),
-                                 broj,
-                                 std::placeholders::_1));
-    }
-
-    // Vracanje rezultata; eksplicitno pomeranje
-    // kako bi se isforsirala optimizacija (RVO)
-    return std::move(rez);
+    // on su koeficijenti matrice
+    auto rez = g.koef();
+
+    // Mnozenje prvih redova, jedinih
+    // koji su zapravo sacuvani
+    std::transform(std::cbegin(rez),
+                   std::cend(rez),
+                   // Red = rezultat
+                   std::begin(rez),
+                   // Mnozenje sleva
+                   std::bind(std::multiplies<>(),
+                             broj,
+                             std::placeholders::_1));
+
+    // Vracanje rezultata
+    return geom(rez);
 }
 
 }
@@ -46,10 +46,18 @@ public:
     geom(const geom&) = default;
 
     // Konstruktor kopije sa semantikom pomeranja;
-    // uzima se podrazumevani sablon pomeranja (move)
-    geom(geom&&) noexcept = default;
-
-    // Konstruktori od vektora
+    // kopira koeficijente, a izvor ostaje prazan
+    geom(geom&&) noexcept;
+
+    // Konstruktor od koeficijenata; nema provere
+    // jer je poslednji red implicitno {0, 0, 1}
+    explicit geom(const Koeficijenti&);
+
+    // Konstruktori od vektora; provera vazi samo
+    // za spoljasnji ulaz (vektori, tok, citac),
+    // dok se rezultatima racuna (proizvod, inverz,
+    // stepen, afine transformacije) veruje, jer
+    // se oni prave direktno od koeficijenata
     geom(const Matrica&);
     geom(Matrica&&);
     geom(const Vektor&, const Vektor&, const Vektor&);
@@ -57,8 +65,12 @@ public:
     geom(const Vektor&, const Vektor&);
     geom(Vektor&&, Vektor&&);
 
-    // Dohvatac za matricu
-    const Matrica& mat() const;
+    // Dohvatac za matricu; pravi se nova
+    // homogena matrica od koeficijenata
+    Matrica mat() const;
+
+    // Dohvatac za koeficijente
+    const Koeficijenti& koef() const;
 
     // Dohvatac za velicinu
     Velicina size() const;
@@ -116,18 +128,32 @@ public:
     geom& operator=(const geom&) = default;
 
     // Operator dodele sa semantikom pomeranja;
-    // podrazumevani sablon pomeranja (move)
-    geom& operator=(geom&&) noexcept = default;
+    // kopira koeficijente, a izvor ostaje prazan
+    geom& operator=(geom&&) noexcept;
 
     // Operatori dodele vektora
     geom& operator=(const Matrica&);
     geom& operator=(Matrica&&);
 
+    // Pogled na jedan red matrice; koristi se
+    // umesto reference na vektor, posto redovi
+    // vise nisu zasebni objekti u memoriji
+    struct Red{
+        // Pokazivac na prvi element reda
+        const Element* red;
+
+        // Indeksiranje sa proverom granica
+        const Element& operator[](const Velicina) const;
+
+        // Pretvaranje u vektor
+        operator Vektor() const;
+    };
+
     // Operator indeksiranja za dohvatanje; eksplicitno
     // oznacen da se ne sme odbaciti, kako bi se dodatno
     // istaklo da je iskljucivo za dohvatanje, ne izmenu
     [[nodiscard]]
-    const Vektor& operator[](const Velicina) const;
+    const Red operator[](const Velicina) const;
 
     // Struktura koja sluzi za citanje
     // toka razdvojenog zapetama
@@ -152,8 +178,9 @@ protected:
     // Transformacija ravni je predstavljena
     // homogenom 3x3 matricom, a podrazumevano
     // je u pitanju jedinicna transformacija;
-    // nije const zbog pomeranja (move)
-    Matrica _mat;
+    // cuvaju se samo prva dva reda, u nizu
+    // fiksne duzine, bez dinamicke alokacije
+    Koeficijenti _mat;
 
     // Matrica preslikavanja ravni fiksno
     // je velicine 3, ali slicno nije const
@@ -165,7 +192,18 @@ protected:
 
 private:
     // Provera korektnosti preslikavanja
-    void proveri();
+    // i preuzimanje koeficijenata matrice
+    void proveri(const Matrica&);
+
+    // Provera poslednjeg reda matrice
+    void proveri(const Element*);
+
+    // Praznjenje preslikavanja; prazno je ono
+    // koje je pomereno (move) ili neispravno
+    void isprazni();
+
+    // Provera praznine preslikavanja
+    bool prazna() const;
 
     // Operator citanja sa ulaznog toka; mora
     // prijateljski kako bi pristupao matrici
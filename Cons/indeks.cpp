@@ -0,0 +1,535 @@
+#include <cmath>
+#include <queue>
+
+#include "indeks.hpp"
+
+// Imenski prostor za geometriju; u ovoj
+// datoteci je prostorni indeks oblika
+namespace geom {
+
+namespace {
+
+// Dvostruko srediste okvira po osi; deljenje
+// sa dva ne menja poredak, pa se izostavlja
+Element sredina(const Okvir& o, const bool y)
+{
+    return y ? o.min_y + o.max_y : o.min_x + o.max_x;
+}
+
+// Povrsina preseka dva okvira
+Element presek(const Okvir& a, const Okvir& b)
+{
+    const auto dx = std::min(a.max_x, b.max_x) - std::max(a.min_x, b.min_x);
+    const auto dy = std::min(a.max_y, b.max_y) - std::max(a.min_y, b.min_y);
+    return dx > 0 && dy > 0 ? dx * dy : 0;
+}
+
+}
+
+// Konstruktor praznog indeksa
+indeks::indeks()
+{
+    isprazni();
+}
+
+// Konstruktor sa pakovanjem oblika
+indeks::indeks(const std::vector<const oblik*>& oblici)
+{
+    napuni(oblici);
+}
+
+// Pakovanje STR; ulazi se po x dele u trake
+// od oko koren iz broja cvorova, svaka traka
+// se uredi po y i pakuje u pune cvorove, a
+// postupak se ponavlja nivo po nivo navise
+void indeks::napuni(const std::vector<const oblik*>& oblici)
+{
+    isprazni();
+    if (oblici.empty()){
+        return;
+    }
+
+    _cvorovi.clear();
+    _listovi.reserve(std::size(oblici));
+
+    std::vector<Ulaz> ulazi;
+    ulazi.reserve(std::size(oblici));
+    for (const auto o : oblici){
+        const auto okvir = o->okvir();
+        if (!okvir.prazan()){
+            ulazi.push_back({okvir, nema, o});
+        }
+    }
+
+    const auto po_x = [](const Ulaz& a, const Ulaz& b)
+                      {return sredina(a.okvir, false) < sredina(b.okvir, false);};
+    const auto po_y = [](const Ulaz& a, const Ulaz& b)
+                      {return sredina(a.okvir, true) < sredina(b.okvir, true);};
+
+    for (Velicina nivo = 0; ; nivo++){
+        const auto n = std::size(ulazi);
+
+        // Poslednji nivo postaje koren
+        if (n <= M){
+            _koren = novi(nivo);
+            for (const auto& u : ulazi){
+                upisi(_koren, u);
+            }
+            break;
+        }
+
+        // Broj cvorova i ulaza po traci
+        const auto cvorova = (n + M - 1) / M;
+        const auto traka = static_cast<Velicina>(std::ceil(std::sqrt(cvorova)));
+        const auto po_traci = (cvorova + traka - 1) / traka * M;
+
+        std::sort(std::begin(ulazi), std::end(ulazi), po_x);
+
+        std::vector<Ulaz> roditelji;
+        roditelji.reserve(cvorova);
+        for (Velicina s = 0; s < n; s += po_traci){
+            const auto kraj_trake = std::min(n, s + po_traci);
+            std::sort(std::begin(ulazi) + s, std::begin(ulazi) + kraj_trake, po_y);
+
+            for (auto i = s; i < kraj_trake; i += M){
+                const auto c = novi(nivo);
+                for (auto j = i; j < std::min(kraj_trake, i + M); j++){
+                    upisi(c, ulazi[j]);
+                }
+                roditelji.push_back({okvir(c), c, nullptr});
+            }
+        }
+
+        ulazi = std::move(roditelji);
+    }
+}
+
+// Dodavanje oblika; vec prisutan
+// oblik se samo azurira
+void indeks::dodaj(const oblik* o)
+{
+    if (_listovi.count(o)){
+        azuriraj(o);
+    } else if (const auto okvir = o->okvir(); !okvir.prazan()){
+        ubaci({okvir, nema, o});
+    }
+}
+
+// Uklanjanje oblika iz njegovog lista
+bool indeks::ukloni(const oblik* o)
+{
+    const auto it = _listovi.find(o);
+    if (it == std::end(_listovi)){
+        return false;
+    }
+
+    const auto c = it->second;
+    _listovi.erase(it);
+
+    auto& cvor = _cvorovi[c];
+    for (Velicina i = 0; i < cvor.broj; i++){
+        if (cvor.ulazi[i].o == o){
+            cvor.ulazi[i] = cvor.ulazi[--cvor.broj];
+            break;
+        }
+    }
+
+    sredi(c);
+    return true;
+}
+
+// Azuriranje okvira; ako se okvir nije
+// promenio, stablo ostaje netaknuto, a
+// oblik sa praznim okvirom se uklanja
+void indeks::azuriraj(const oblik* o)
+{
+    const auto okvir = o->okvir();
+    if (okvir.prazan()){
+        ukloni(o);
+        return;
+    }
+
+    const auto it = _listovi.find(o);
+    if (it != std::end(_listovi)){
+        const auto& cvor = _cvorovi[it->second];
+        for (Velicina i = 0; i < cvor.broj; i++){
+            if (cvor.ulazi[i].o == o && cvor.ulazi[i].okvir == okvir){
+                return;
+            }
+        }
+        ukloni(o);
+    }
+
+    ubaci({okvir, nema, o});
+}
+
+// Praznjenje indeksa
+void indeks::isprazni()
+{
+    _cvorovi.clear();
+    _slobodni.clear();
+    _listovi.clear();
+    _koren = novi(0);
+}
+
+// Dohvatac za broj oblika
+Velicina indeks::size() const
+{
+    return std::size(_listovi);
+}
+
+// Provera praznine
+bool indeks::empty() const
+{
+    return _listovi.empty();
+}
+
+// Okvir svih oblika u indeksu
+Okvir indeks::okvir() const
+{
+    return okvir(_koren);
+}
+
+// Obilazak oblika ciji okvir sece zadati
+void indeks::trazi(const Okvir& okvir,
+                   const std::function<bool(const oblik*)>& obrada) const
+{
+    std::vector<Velicina> stek{_koren};
+    while (!stek.empty()){
+        const auto& cvor = _cvorovi[stek.back()];
+        stek.pop_back();
+
+        for (Velicina i = 0; i < cvor.broj; i++){
+            const auto& u = cvor.ulazi[i];
+            if (!u.okvir.sece(okvir)){
+                continue;
+            }
+
+            if (cvor.nivo != 0){
+                stek.push_back(u.dete);
+            } else if (!obrada(u.o)){
+                return;
+            }
+        }
+    }
+}
+
+// Oblici ciji okvir sece zadati
+std::vector<const oblik*> indeks::trazi(const Okvir& okvir) const
+{
+    std::vector<const oblik*> rez;
+    trazi(okvir, [&rez](const oblik* o){
+        rez.push_back(o);
+        return true;
+    });
+
+    return rez;
+}
+
+// Oblici ciji okvir sadrzi tacku
+std::vector<const oblik*> indeks::trazi(const tacka& t) const
+{
+    const auto& k = t.koord();
+    return trazi(Okvir{k[0], k[1], k[0], k[1]});
+}
+
+// Najblizi oblici; pretraga prvo najboljeg, gde
+// se iz reda uvek uzima najblizi kandidat, bilo
+// cvor ili oblik, pa su oblici izvuceni redom
+std::vector<const oblik*> indeks::najblizi(const tacka& t, const Velicina k) const
+{
+    struct Kandidat
+    {
+        Element rastojanje;
+        Velicina cvor;
+        const oblik* o;
+
+        bool operator>(const Kandidat& drugi) const
+        {
+            return rastojanje > drugi.rastojanje;
+        }
+    };
+
+    const auto& x = t.koord();
+    std::priority_queue<Kandidat, std::vector<Kandidat>, std::greater<Kandidat>> red;
+    red.push({0, _koren, nullptr});
+
+    std::vector<const oblik*> rez;
+    while (!red.empty() && std::size(rez) < k){
+        const auto kandidat = red.top();
+        red.pop();
+
+        if (kandidat.o != nullptr){
+            rez.push_back(kandidat.o);
+            continue;
+        }
+
+        const auto& cvor = _cvorovi[kandidat.cvor];
+        for (Velicina i = 0; i < cvor.broj; i++){
+            const auto& u = cvor.ulazi[i];
+            red.push({u.okvir.rastojanje2(x[0], x[1]),
+                      u.dete, cvor.nivo == 0 ? u.o : nullptr});
+        }
+    }
+
+    return rez;
+}
+
+// Visina stabla
+Velicina indeks::visina() const
+{
+    return _cvorovi[_koren].nivo + 1;
+}
+
+// Pravljenje cvora, na slobodnom mestu ako ga ima
+Velicina indeks::novi(const Velicina nivo)
+{
+    Velicina c;
+    if (_slobodni.empty()){
+        c = std::size(_cvorovi);
+        _cvorovi.emplace_back();
+    } else {
+        c = _slobodni.back();
+        _slobodni.pop_back();
+    }
+
+    auto& cvor = _cvorovi[c];
+    cvor.roditelj = nema;
+    cvor.nivo = nivo;
+    cvor.broj = 0;
+
+    return c;
+}
+
+// Oslobadjanje cvora
+void indeks::oslobodi(const Velicina c)
+{
+    _cvorovi[c].broj = 0;
+    _slobodni.push_back(c);
+}
+
+// Okvir svih ulaza cvora
+Okvir indeks::okvir(const Velicina c) const
+{
+    const auto& cvor = _cvorovi[c];
+
+    Okvir rez;
+    for (Velicina i = 0; i < cvor.broj; i++){
+        rez.prosiri(cvor.ulazi[i].okvir);
+    }
+
+    return rez;
+}
+
+// Polozaj ulaza cvora u roditelju
+Velicina indeks::polozaj(const Velicina c) const
+{
+    const auto& roditelj = _cvorovi[_cvorovi[c].roditelj];
+
+    Velicina i = 0;
+    while (roditelj.ulazi[i].dete != c){
+        i++;
+    }
+
+    return i;
+}
+
+// Upis ulaza u cvor koji ima mesta
+void indeks::upisi(const Velicina c, const Ulaz& u)
+{
+    auto& cvor = _cvorovi[c];
+    cvor.ulazi[cvor.broj++] = u;
+
+    if (cvor.nivo == 0){
+        _listovi[u.o] = c;
+    } else {
+        _cvorovi[u.dete].roditelj = c;
+    }
+}
+
+// Ubacivanje oblika; spusta se niz cvorove cije
+// se okvir najmanje povecava, a zatim se navise
+// azuriraju okviri i prosledjuju eventualna deljenja
+void indeks::ubaci(const Ulaz& ulaz)
+{
+    auto c = _koren;
+    while (_cvorovi[c].nivo != 0){
+        const auto& cvor = _cvorovi[c];
+
+        Velicina najbolji = 0;
+        Element najmanje = std::numeric_limits<Element>::infinity();
+        Element povrsina = najmanje;
+        for (Velicina i = 0; i < cvor.broj; i++){
+            const auto& o = cvor.ulazi[i].okvir;
+            const auto p = o.povrsina();
+            const auto uvecanje = spoj(o, ulaz.okvir).povrsina() - p;
+            if (uvecanje < najmanje || (uvecanje == najmanje && p < povrsina)){
+                najbolji = i;
+                najmanje = uvecanje;
+                povrsina = p;
+            }
+        }
+
+        c = cvor.ulazi[najbolji].dete;
+    }
+
+    // Upis u list, uz deljenje ako je pun
+    auto podeljen = nema;
+    if (_cvorovi[c].broj < M){
+        upisi(c, ulaz);
+    } else {
+        podeljen = podeli(c, ulaz);
+    }
+
+    // Azuriranje predaka
+    while (c != _koren){
+        const auto r = _cvorovi[c].roditelj;
+        _cvorovi[r].ulazi[polozaj(c)].okvir = okvir(c);
+
+        if (podeljen != nema){
+            const Ulaz u{okvir(podeljen), podeljen, nullptr};
+            if (_cvorovi[r].broj < M){
+                upisi(r, u);
+                podeljen = nema;
+            } else {
+                podeljen = podeli(r, u);
+            }
+        }
+
+        c = r;
+    }
+
+    // Podeljen koren dobija novi koren
+    if (podeljen != nema){
+        _koren = novi(_cvorovi[c].nivo + 1);
+        upisi(_koren, {okvir(c), c, nullptr});
+        upisi(_koren, {okvir(podeljen), podeljen, nullptr});
+    }
+}
+
+// Deljenje prepunjenog cvora po uzoru na R*
+// stablo; bira se osa sa najmanjim zbirom obima
+// svih dozvoljenih podela, a na njoj podela sa
+// najmanjim preklapanjem, pa najmanjom povrsinom
+Velicina indeks::podeli(const Velicina c, const Ulaz& ulaz)
+{
+    std::array<Ulaz, M+1> ulazi;
+    std::copy_n(std::cbegin(_cvorovi[c].ulazi), M, std::begin(ulazi));
+    ulazi[M] = ulaz;
+
+    // Okviri levih i desnih delova
+    std::array<Okvir, M+1> levo, desno;
+    const auto delovi = [&ulazi, &levo, &desno](const bool y){
+        std::sort(std::begin(ulazi), std::end(ulazi),
+                  [y](const Ulaz& a, const Ulaz& b)
+                  {return sredina(a.okvir, y) < sredina(b.okvir, y);});
+
+        Okvir o;
+        for (Velicina i = 0; i <= M; i++){
+            o.prosiri(ulazi[i].okvir);
+            levo[i] = o;
+        }
+
+        o = Okvir();
+        for (auto i = M+1; i-- > 0; ){
+            o.prosiri(ulazi[i].okvir);
+            desno[i] = o;
+        }
+    };
+
+    // Izbor ose
+    Element obim[2];
+    for (const auto y : {false, true}){
+        delovi(y);
+        obim[y] = 0;
+        for (auto k = m; k <= M+1-m; k++){
+            obim[y] += levo[k-1].poluobim() + desno[k].poluobim();
+        }
+    }
+
+    if (obim[0] <= obim[1]){
+        delovi(false);
+    }
+
+    // Izbor podele; prvih k ulaza ostaje
+    auto najbolje = m;
+    auto preklapanje = std::numeric_limits<Element>::infinity();
+    auto povrsina = preklapanje;
+    for (auto k = m; k <= M+1-m; k++){
+        const auto p = presek(levo[k-1], desno[k]);
+        const auto a = levo[k-1].povrsina() + desno[k].povrsina();
+        if (p < preklapanje || (p == preklapanje && a < povrsina)){
+            najbolje = k;
+            preklapanje = p;
+            povrsina = a;
+        }
+    }
+
+    // Raspodela ulaza
+    const auto drugi = novi(_cvorovi[c].nivo);
+    _cvorovi[c].broj = 0;
+    for (Velicina i = 0; i <= M; i++){
+        upisi(i < najbolje ? c : drugi, ulazi[i]);
+    }
+
+    return drugi;
+}
+
+// Sredjivanje posle uklanjanja; cvorovi sa
+// premalo ulaza se izbacuju, a njihovi oblici
+// se ponovo ubacuju, kao u izvornom R-stablu
+void indeks::sredi(Velicina c)
+{
+    std::vector<Ulaz> sirocad;
+
+    while (c != _koren){
+        const auto r = _cvorovi[c].roditelj;
+        const auto i = polozaj(c);
+        auto& roditelj = _cvorovi[r];
+
+        if (_cvorovi[c].broj < m){
+            roditelj.ulazi[i] = roditelj.ulazi[--roditelj.broj];
+            skupi(c, sirocad);
+        } else {
+            roditelj.ulazi[i].okvir = okvir(c);
+        }
+
+        c = r;
+    }
+
+    // Skracivanje stabla sa korenom
+    // koji ima samo jedno dete
+    while (_cvorovi[_koren].nivo != 0 && _cvorovi[_koren].broj == 1){
+        const auto stari = _koren;
+        _koren = _cvorovi[stari].ulazi[0].dete;
+        _cvorovi[_koren].roditelj = nema;
+        oslobodi(stari);
+    }
+
+    // Koren bez ikakvih ulaza je prazan list
+    if (_cvorovi[_koren].broj == 0){
+        _cvorovi[_koren].nivo = 0;
+    }
+
+    for (const auto& u : sirocad){
+        ubaci(u);
+    }
+}
+
+// Skupljanje oblika iz podstabla i
+// oslobadjanje svih njegovih cvorova
+void indeks::skupi(const Velicina c, std::vector<Ulaz>& oblici)
+{
+    const auto& cvor = _cvorovi[c];
+    for (Velicina i = 0; i < cvor.broj; i++){
+        if (cvor.nivo == 0){
+            oblici.push_back(cvor.ulazi[i]);
+        } else {
+            skupi(cvor.ulazi[i].dete, oblici);
+        }
+    }
+
+    oslobodi(c);
+}
+
+}
@@ -0,0 +1,138 @@
+#ifndef INDEKS_HPP
+#define INDEKS_HPP
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include "oblik.hpp"
+
+// Imenski prostor za geometriju
+namespace geom {
+
+// Prostorni indeks oblika kao R-stablo nad
+// njihovim okvirima; moze se napuniti odjednom
+// (pakovanje STR, Sort-Tile-Recursive), a zatim
+// menjati dodavanjem i uklanjanjem pojedinacnih
+// oblika; indeks ne poseduje oblike, vec samo
+// pamti njihove okvire u trenutku dodavanja, pa
+// se izmenjen oblik mora azurirati u indeksu;
+// oblici bez tacaka imaju prazan okvir, koji ne
+// sece nijedan drugi, pa se ni ne indeksiraju
+class indeks
+{
+public:
+    // Najveci i najmanji broj ulaza u cvoru
+    static constexpr Velicina M = 16;
+    static constexpr Velicina m = 6;
+
+    // Konstruktor praznog indeksa
+    indeks();
+
+    // Konstruktor sa pakovanjem oblika
+    explicit indeks(const std::vector<const oblik*>&);
+
+    // Ponovno punjenje pakovanjem oblika
+    void napuni(const std::vector<const oblik*>&);
+
+    // Dodavanje oblika
+    void dodaj(const oblik*);
+
+    // Uklanjanje oblika; vraca da li ga je bilo
+    bool ukloni(const oblik*);
+
+    // Azuriranje okvira izmenjenog oblika
+    void azuriraj(const oblik*);
+
+    // Praznjenje indeksa
+    void isprazni();
+
+    // Dohvatac za broj oblika
+    Velicina size() const;
+
+    // Provera praznine
+    bool empty() const;
+
+    // Okvir svih oblika u indeksu
+    Okvir okvir() const;
+
+    // Obilazak oblika ciji okvir sece zadati; obrada
+    // moze vratiti false da bi se obilazak prekinuo
+    void trazi(const Okvir&, const std::function<bool(const oblik*)>&) const;
+
+    // Oblici ciji okvir sece zadati
+    std::vector<const oblik*> trazi(const Okvir&) const;
+
+    // Oblici ciji okvir sadrzi tacku
+    std::vector<const oblik*> trazi(const tacka&) const;
+
+    // Najblizih k oblika tacki, po rastojanju
+    // do okvira, od najblizeg ka najdaljem
+    std::vector<const oblik*> najblizi(const tacka&, const Velicina = 1) const;
+
+    // Visina stabla, radi provere i merenja
+    Velicina visina() const;
+
+private:
+    // Ulaz u cvoru; u listu pokazuje na
+    // oblik, a u ostalim cvorovima na dete
+    struct Ulaz
+    {
+        Okvir okvir;
+        Velicina dete;
+        const oblik* o;
+    };
+
+    // Cvor stabla; listovi su na nivou nula
+    struct Cvor
+    {
+        Velicina roditelj;
+        Velicina nivo;
+        Velicina broj;
+        std::array<Ulaz, M> ulazi;
+    };
+
+    // Oznaka nepostojeceg cvora
+    static constexpr Velicina nema = static_cast<Velicina>(-1);
+
+    // Pravljenje i oslobadjanje cvora
+    Velicina novi(const Velicina);
+    void oslobodi(const Velicina);
+
+    // Okvir svih ulaza cvora
+    Okvir okvir(const Velicina) const;
+
+    // Polozaj ulaza cvora u roditelju
+    Velicina polozaj(const Velicina) const;
+
+    // Upis ulaza u cvor, uz pamcenje
+    // lista u kom se oblik nalazi
+    void upisi(const Velicina, const Ulaz&);
+
+    // Ubacivanje oblika u odgovarajuci list
+    void ubaci(const Ulaz&);
+
+    // Deljenje prepunjenog cvora
+    Velicina podeli(const Velicina, const Ulaz&);
+
+    // Sredjivanje stabla posle uklanjanja
+    void sredi(Velicina);
+
+    // Skupljanje oblika iz podstabla
+    void skupi(const Velicina, std::vector<Ulaz>&);
+
+    // Cvorovi stabla i slobodna mesta
+    std::vector<Cvor> _cvorovi;
+    std::vector<Velicina> _slobodni;
+
+    // Koren stabla
+    Velicina _koren;
+
+    // List u kom se nalazi svaki oblik
+    std::unordered_map<const oblik*, Velicina> _listovi;
+};
+
+}
+
+#endif // INDEKS_HPP
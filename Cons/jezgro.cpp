@@ -0,0 +1,309 @@
+#include "jezgro.hpp"
+
+#include <atomic>
+#include <type_traits>
+
+// Eksplicitna vektorizacija je podrzana samo
+// na x86 procesorima i GCC-u ili Clang-u, koji
+// dozvoljavaju da se pojedinacne fje prevedu
+// za napredniji skup instrukcija od ostatka
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GEOM_SIMD
+#include <immintrin.h>
+#endif
+
+// Imenski prostor za geometriju; u ovoj
+// datoteci je jezgro paketne primene afinih
+// transformacija na velike nizove tacaka
+namespace geom {
+
+// Tacke u nizu moraju biti samo parovi
+// koordinata, bez ikakvih dodataka, kako
+// bi se niz mogao tretirati kao niz brojeva
+static_assert(sizeof(tacka) == sizeof(Koordinate),
+              "Tacka nije samo par koordinata!");
+static_assert(std::is_standard_layout_v<tacka>,
+              "Tacka nema standardan raspored!");
+
+// Jezgra za oba rasporeda koordinata; u nazivu
+// je skup instrukcija kojim je jezgro napisano;
+// redosled operacija je svuda isti, (a*x + b*y) + c,
+// kako bi rezultati bili identicni do na bit
+namespace {
+
+// Skalarno jezgro nad parovima koordinata
+void parovi_skalarno(const Koeficijenti& k, Element* xy, const Velicina n)
+{
+    const auto [a, b, c,
+                d, e, f] = k;
+
+    for (Velicina i = 0; i < n; i++){
+        const auto x = xy[2*i];
+        const auto y = xy[2*i+1];
+
+        xy[2*i]   = a*x + b*y + c;
+        xy[2*i+1] = d*x + e*y + f;
+    }
+}
+
+// Skalarno jezgro nad odvojenim nizovima; petlja
+// bez grananja i sa jednostavnim pristupom
+// memoriji, koju prevodilac moze da vektorizuje
+void nizovi_skalarno(const Koeficijenti& k, Element* xs, Element* ys, const Velicina n)
+{
+    const auto [a, b, c,
+                d, e, f] = k;
+
+    for (Velicina i = 0; i < n; i++){
+        const auto x = xs[i];
+        const auto y = ys[i];
+
+        xs[i] = a*x + b*y + c;
+        ys[i] = d*x + e*y + f;
+    }
+}
+
+#ifdef GEOM_SIMD
+// SSE2 jezgro nad parovima koordinata; u registru
+// je jedna tacka [x y], od koje se prave [x x] i
+// [y y], pa se mnoze kolonama [a d] i [b e]
+__attribute__((target("sse2")))
+void parovi_sse2(const Koeficijenti& k, Element* xy, const Velicina n)
+{
+    const auto ad = _mm_setr_pd(k[0], k[3]);
+    const auto be = _mm_setr_pd(k[1], k[4]);
+    const auto cf = _mm_setr_pd(k[2], k[5]);
+
+    // Po dve tacke u svakom prolazu
+    Velicina i = 0;
+    for (; i+2 <= n; i += 2){
+        const auto t0 = _mm_loadu_pd(xy+2*i);
+        const auto t1 = _mm_loadu_pd(xy+2*i+2);
+
+        const auto r0 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(t0, t0), ad),
+                                              _mm_mul_pd(_mm_unpackhi_pd(t0, t0), be)),
+                                   cf);
+        const auto r1 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(t1, t1), ad),
+                                              _mm_mul_pd(_mm_unpackhi_pd(t1, t1), be)),
+                                   cf);
+
+        _mm_storeu_pd(xy+2*i, r0);
+        _mm_storeu_pd(xy+2*i+2, r1);
+    }
+
+    // Preostala tacka, ako je ima
+    parovi_skalarno(k, xy+2*i, n-i);
+}
+
+// SSE2 jezgro nad odvojenim nizovima; po
+// cetiri tacke, u dva para registara
+__attribute__((target("sse2")))
+void nizovi_sse2(const Koeficijenti& k, Element* xs, Element* ys, const Velicina n)
+{
+    const auto a = _mm_set1_pd(k[0]);
+    const auto b = _mm_set1_pd(k[1]);
+    const auto c = _mm_set1_pd(k[2]);
+    const auto d = _mm_set1_pd(k[3]);
+    const auto e = _mm_set1_pd(k[4]);
+    const auto f = _mm_set1_pd(k[5]);
+
+    Velicina i = 0;
+    for (; i+4 <= n; i += 4){
+        for (Velicina j = i; j < i+4; j += 2){
+            const auto x = _mm_loadu_pd(xs+j);
+            const auto y = _mm_loadu_pd(ys+j);
+
+            _mm_storeu_pd(xs+j, _mm_add_pd(_mm_add_pd(_mm_mul_pd(a, x),
+                                                      _mm_mul_pd(b, y)), c));
+            _mm_storeu_pd(ys+j, _mm_add_pd(_mm_add_pd(_mm_mul_pd(d, x),
+                                                      _mm_mul_pd(e, y)), f));
+        }
+    }
+
+    // Preostale tacke, ako ih ima
+    nizovi_skalarno(k, xs+i, ys+i, n-i);
+}
+
+// AVX2 jezgro nad parovima koordinata; u registru
+// su dve tacke [x0 y0 x1 y1], od kojih se prave
+// [x0 x0 x1 x1] i [y0 y0 y1 y1], kao kod SSE2
+__attribute__((target("avx2")))
+void parovi_avx2(const Koeficijenti& k, Element* xy, const Velicina n)
+{
+    const auto ad = _mm256_setr_pd(k[0], k[3], k[0], k[3]);
+    const auto be = _mm256_setr_pd(k[1], k[4], k[1], k[4]);
+    const auto cf = _mm256_setr_pd(k[2], k[5], k[2], k[5]);
+
+    // Po cetiri tacke u svakom prolazu
+    Velicina i = 0;
+    for (; i+4 <= n; i += 4){
+        const auto t0 = _mm256_loadu_pd(xy+2*i);
+        const auto t1 = _mm256_loadu_pd(xy+2*i+4);
+
+        const auto r0 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_movedup_pd(t0), ad),
+                                                    _mm256_mul_pd(_mm256_permute_pd(t0, 0xF), be)),
+                                      cf);
+        const auto r1 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_movedup_pd(t1), ad),
+                                                    _mm256_mul_pd(_mm256_permute_pd(t1, 0xF), be)),
+                                      cf);
+
+        _mm256_storeu_pd(xy+2*i, r0);
+        _mm256_storeu_pd(xy+2*i+4, r1);
+    }
+
+    // Preostale tacke, ako ih ima
+    parovi_skalarno(k, xy+2*i, n-i);
+}
+
+// AVX2 jezgro nad odvojenim nizovima; po
+// osam tacaka, u dva para registara
+__attribute__((target("avx2")))
+void nizovi_avx2(const Koeficijenti& k, Element* xs, Element* ys, const Velicina n)
+{
+    const auto a = _mm256_set1_pd(k[0]);
+    const auto b = _mm256_set1_pd(k[1]);
+    const auto c = _mm256_set1_pd(k[2]);
+    const auto d = _mm256_set1_pd(k[3]);
+    const auto e = _mm256_set1_pd(k[4]);
+    const auto f = _mm256_set1_pd(k[5]);
+
+    Velicina i = 0;
+    for (; i+8 <= n; i += 8){
+        for (Velicina j = i; j < i+8; j += 4){
+            const auto x = _mm256_loadu_pd(xs+j);
+            const auto y = _mm256_loadu_pd(ys+j);
+
+            _mm256_storeu_pd(xs+j, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(a, x),
+                                                               _mm256_mul_pd(b, y)), c));
+            _mm256_storeu_pd(ys+j, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(d, x),
+                                                               _mm256_mul_pd(e, y)), f));
+        }
+    }
+
+    // Preostale tacke, ako ih ima
+    nizovi_skalarno(k, xs+i, ys+i, n-i);
+}
+#endif
+
+// Tipovi pokazivaca na jezgra
+using Parovi = void (*)(const Koeficijenti&, Element*, const Velicina);
+using Nizovi = void (*)(const Koeficijenti&, Element*, Element*, const Velicina);
+
+// Jezgra jednog skupa instrukcija
+struct Izbor{
+    Instrukcije skup;
+    Parovi parovi;
+    Nizovi nizovi;
+};
+
+// Jezgra koja odgovaraju skupu instrukcija; opisi
+// su staticki i nepromenljivi, pa se izbor menja
+// samo atomicnom zamenom pokazivaca na opis
+const Izbor* jezgra(const Instrukcije skup)
+{
+    static const Izbor skalarno{Instrukcije::skalarne, parovi_skalarno, nizovi_skalarno};
+#ifdef GEOM_SIMD
+    static const Izbor avx2{Instrukcije::avx2, parovi_avx2, nizovi_avx2};
+    static const Izbor sse2{Instrukcije::sse2, parovi_sse2, nizovi_sse2};
+#endif
+
+    switch (skup){
+#ifdef GEOM_SIMD
+    case Instrukcije::avx2:
+        return &avx2;
+    case Instrukcije::sse2:
+        return &sse2;
+#endif
+    default:
+        return &skalarno;
+    }
+}
+
+// Trenutno izabrana jezgra; staticka promenljiva
+// se inicijalizuje tacno jednom (CPUID), a posle
+// se moze menjati i dok radne niti primenjuju
+// transformacije, jer svaki poziv jednom cita
+// ceo opis, pa ne vidi mesavinu dva izbora
+std::atomic<const Izbor*>& izabrano()
+{
+    static std::atomic<const Izbor*> izb{jezgra(podrzane())};
+    return izb;
+}
+
+// Dohvatac trenutnog izbora
+const Izbor& izbor()
+{
+    return *izabrano().load(std::memory_order_acquire);
+}
+
+}
+
+// Najbolji skup koji procesor podrzava;
+// provera se vrsi instrukcijom CPUID
+Instrukcije podrzane()
+{
+#ifdef GEOM_SIMD
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")){
+        return Instrukcije::avx2;
+    }
+
+    if (__builtin_cpu_supports("sse2")){
+        return Instrukcije::sse2;
+    }
+#endif
+
+    return Instrukcije::skalarne;
+}
+
+// Skup instrukcija koji se trenutno koristi
+Instrukcije instrukcije()
+{
+    return izbor().skup;
+}
+
+// Izbor skupa instrukcija; nije dozvoljen
+// skup koji procesor ne podrzava
+void koristi(const Instrukcije skup)
+{
+    if (skup > podrzane()){
+        throw Exc("Skup instrukcija nije podrzan!");
+    }
+
+    izabrano().store(jezgra(skup), std::memory_order_release);
+}
+
+// Paketna primena transformacije na niz tacaka;
+// koeficijenti se izvlace jednom, pre petlje, a
+// svaka tacka se menja u mestu, bez alokacija
+// i bez provere, posto je afina slika tacke
+// uvek ispravna, homogena tacka; niz tacaka
+// je zapravo niz uzastopnih parova koordinata
+void primeni(const geom& g, NizTacaka& tacke)
+{
+    primeni(g, std::data(tacke), std::size(tacke));
+}
+
+// Paketna primena na uzastopne tacke; ovo je
+// jedino mesto gde se ceo niz tacaka tumaci kao
+// niz brojeva, sto dozvoljavaju gornje provere
+// velicine i rasporeda tacke
+void primeni(const geom& g, tacka* tacke, const Velicina n)
+{
+    izbor().parovi(g.koef(), reinterpret_cast<Element*>(tacke), n);
+}
+
+// Paketna primena na uzastopne parove koordinata
+void primeni(const geom& g, Element* xy, const Velicina n)
+{
+    izbor().parovi(g.koef(), xy, n);
+}
+
+// Paketna primena na odvojene nizove koordinata
+void primeni(const geom& g, Element* xs, Element* ys, const Velicina n)
+{
+    izbor().nizovi(g.koef(), xs, ys, n);
+}
+
+}
@@ -0,0 +1,44 @@
+#ifndef JEZGRO_HPP
+#define JEZGRO_HPP
+
+#include "tacka.hpp"
+
+// Imenski prostor za geometriju
+namespace geom {
+
+// Skupovi instrukcija kojima se moze
+// vrsiti paketna primena transformacija
+enum class Instrukcije { skalarne, sse2, avx2 };
+
+// Najbolji skup koji procesor podrzava
+Instrukcije podrzane();
+
+// Skup instrukcija koji se trenutno koristi
+Instrukcije instrukcije();
+
+// Izbor skupa instrukcija; podrazumevano se
+// pri pokretanju bira najbolji podrzan skup;
+// izbor je atomican, pa je dozvoljen i dok
+// radne niti primenjuju transformacije, a
+// vec zapoceta primena zavrsava sa starim
+void koristi(const Instrukcije);
+
+// Paketna primena transformacije na niz
+// tacaka, u jednom prolazu kroz memoriju
+void primeni(const geom&, NizTacaka&);
+
+// Paketna primena na uzastopne tacke
+// zadate pocetkom i brojem tacaka
+void primeni(const geom&, tacka*, const Velicina);
+
+// Paketna primena na uzastopne parove
+// koordinata oblika x0, y0, x1, y1, ...
+void primeni(const geom&, Element*, const Velicina);
+
+// Paketna primena na odvojene nizove
+// koordinata x i y (struktura nizova)
+void primeni(const geom&, Element*, Element*, const Velicina);
+
+}
+
+#endif // JEZGRO_HPP
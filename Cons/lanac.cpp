@@ -0,0 +1,95 @@
+#include "lanac.hpp"
+#include "jezgro.hpp"
+
+// Imenski prostor za geometriju; u ovoj
+// datoteci je lanac afinih transformacija
+namespace geom {
+
+// Konstruktor lanca
+lanac::lanac(const bool debug)
+    : _debug(debug)
+{}
+
+// Dodavanje koraka; kako se tacka mnozi zdesna,
+// novi korak mnozi dosadasnji proizvod sleva:
+// primena T1, pa T2, pa T3 je isto sto i T3*T2*T1
+lanac& lanac::dodaj(const geom& g)
+{
+    _ukupno = g * _ukupno;
+    _size++;
+
+    if (_debug){
+        _koraci.push_back(g);
+    }
+
+    return *this;
+}
+
+// Dohvatac za slozenu transformaciju
+const geom& lanac::ukupno() const
+{
+    return _ukupno;
+}
+
+// Dohvatac za pojedinacne korake
+const std::vector<geom>& lanac::koraci() const
+{
+    return _koraci;
+}
+
+// Dohvatac za rezim otklanjanja gresaka
+bool lanac::debug() const
+{
+    return _debug;
+}
+
+// Dohvatac za broj koraka
+Velicina lanac::size() const
+{
+    return _size;
+}
+
+// Vracanje na prazan lanac
+void lanac::isprazni()
+{
+    _ukupno = geom();
+    _koraci.clear();
+    _size = 0;
+}
+
+// Primena lanca na niz tacaka
+void lanac::primeni(NizTacaka& tacke) const
+{
+    ::geom::primeni(_ukupno, tacke);
+}
+
+// Primena lanca na oblik
+void lanac::primeni(oblik& o) const
+{
+    o.transformisi(_ukupno);
+}
+
+// Stanja niza tacaka nakon svakog koraka; svaki
+// korak se primenjuje na prethodno stanje, pa je
+// poslednje stanje jednako primeni celog lanca
+// do na gresku zaokruzivanja
+std::vector<NizTacaka> lanac::medjurezultati(const NizTacaka& tacke) const
+{
+    if (!_debug){
+        throw Exc("Lanac ne cuva pojedinacne korake!");
+    }
+
+    std::vector<NizTacaka> rez;
+    rez.reserve(std::size(_koraci));
+
+    auto stanje = tacke;
+    for (const auto& korak : _koraci){
+        ::geom::primeni(korak, stanje);
+        rez.push_back(stanje);
+    }
+
+    // Vracanje rezultata
+    return rez;
+}
+
+}
@@ -0,0 +1,64 @@
+#ifndef LANAC_HPP
+#define LANAC_HPP
+
+#include "oblik.hpp"
+
+// Imenski prostor za geometriju
+namespace geom {
+
+// Lanac afinih transformacija; koraci se
+// slazu u jednu jedinu matricu, pa primena
+// lanca od n koraka zahteva samo jedan
+// prolaz kroz tacke, a ne n prolaza
+class lanac
+{
+public:
+    // Konstruktor; u rezimu za otklanjanje gresaka
+    // (debug) cuvaju se i pojedinacni koraci
+    explicit lanac(const bool = false);
+
+    // Dodavanje koraka, koji se primenjuje
+    // nakon svih prethodno dodatih koraka
+    lanac& dodaj(const geom&);
+
+    // Dohvatac za slozenu transformaciju
+    const geom& ukupno() const;
+
+    // Dohvatac za pojedinacne korake; prazan
+    // ako lanac nije u rezimu otklanjanja gresaka
+    const std::vector<geom>& koraci() const;
+
+    // Dohvatac za rezim otklanjanja gresaka
+    bool debug() const;
+
+    // Dohvatac za broj koraka
+    Velicina size() const;
+
+    // Vracanje na prazan lanac
+    void isprazni();
+
+    // Primena lanca u jednom prolazu
+    void primeni(NizTacaka&) const;
+    void primeni(oblik&) const;
+
+    // Stanja niza tacaka nakon svakog koraka;
+    // moguce samo u rezimu otklanjanja gresaka
+    std::vector<NizTacaka> medjurezultati(const NizTacaka&) const;
+
+private:
+    // Slozena transformacija
+    geom _ukupno;
+
+    // Pojedinacni koraci
+    std::vector<geom> _koraci;
+
+    // Broj koraka
+    Velicina _size = 0;
+
+    // Indikator rezima otklanjanja gresaka
+    bool _debug;
+};
+
+}
+
+#endif // LANAC_HPP
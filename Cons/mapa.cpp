@@ -0,0 +1,179 @@
+#include "mapa.hpp"
+#include "geom.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Imenski prostor za geometriju; u ovoj
+// datoteci je mapiranje datoteke u memoriju
+namespace geom {
+
+#ifdef _WIN32
+
+// Anonimni prostor za pomocne funkcije
+namespace {
+
+// Putanja u UTF-16, kakvu ocekuje Windows API;
+// uska verzija API-ja koristi kodnu stranu
+// sistema, pa ne moze otvoriti svaku putanju
+std::wstring siroka(const std::string& putanja)
+{
+    const auto duzina = static_cast<int>(std::size(putanja));
+    const auto n = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS,
+                                       std::data(putanja), duzina, nullptr, 0);
+    if (n <= 0 && duzina > 0){
+        throw Exc("Neispravna putanja " + putanja + "!");
+    }
+
+    std::wstring rez(n, L'\0');
+    MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS,
+                        std::data(putanja), duzina, std::data(rez), n);
+
+    return rez;
+}
+
+}
+
+// Mapiranje datoteke preko Windows API-ja
+mapa::mapa(const std::string& putanja)
+{
+    const auto datoteka = CreateFileW(siroka(putanja).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                      nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (datoteka == INVALID_HANDLE_VALUE){
+        throw Exc("Nije moguce otvoriti " + putanja + "!");
+    }
+
+    LARGE_INTEGER velicina;
+    if (!GetFileSizeEx(datoteka, &velicina)){
+        CloseHandle(datoteka);
+        throw Exc("Nije moguce procitati " + putanja + "!");
+    }
+
+    // Prazna datoteka se ne moze mapirati
+    _size = static_cast<Velicina>(velicina.QuadPart);
+    if (_size == 0){
+        CloseHandle(datoteka);
+        return;
+    }
+
+    _rucka = CreateFileMappingW(datoteka, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(datoteka);
+    if (_rucka == nullptr){
+        throw Exc("Nije moguce mapirati " + putanja + "!");
+    }
+
+    _data = static_cast<const char*>(MapViewOfFile(_rucka, FILE_MAP_READ, 0, 0, 0));
+    if (_data == nullptr){
+        CloseHandle(_rucka);
+        throw Exc("Nije moguce mapirati " + putanja + "!");
+    }
+}
+
+// Uklanjanje mapiranja
+void mapa::zatvori()
+{
+    if (_data != nullptr){
+        UnmapViewOfFile(_data);
+        CloseHandle(_rucka);
+    }
+}
+
+#else
+
+// Mapiranje datoteke preko POSIX mmap
+mapa::mapa(const std::string& putanja)
+{
+    const auto datoteka = open(putanja.c_str(), O_RDONLY);
+    if (datoteka < 0){
+        throw Exc("Nije moguce otvoriti " + putanja + "!");
+    }
+
+    struct stat info;
+    if (fstat(datoteka, &info) != 0){
+        close(datoteka);
+        throw Exc("Nije moguce procitati " + putanja + "!");
+    }
+
+    // Prazna datoteka se ne moze mapirati
+    _size = static_cast<Velicina>(info.st_size);
+    if (_size == 0){
+        close(datoteka);
+        return;
+    }
+
+    // Mapiranje ostaje vazece i nakon
+    // zatvaranja opisa datoteke
+    const auto p = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, datoteka, 0);
+    close(datoteka);
+    if (p == MAP_FAILED){
+        throw Exc("Nije moguce mapirati " + putanja + "!");
+    }
+
+    // Najava sekvencijalnog citanja
+    madvise(p, _size, MADV_SEQUENTIAL);
+
+    _data = static_cast<const char*>(p);
+}
+
+// Uklanjanje mapiranja
+void mapa::zatvori()
+{
+    if (_data != nullptr){
+        munmap(const_cast<char*>(_data), _size);
+    }
+}
+
+#endif
+
+// Destruktor
+mapa::~mapa()
+{
+    zatvori();
+}
+
+// Konstruktor pomeranja; izvor ostaje prazan
+mapa::mapa(mapa&& m) noexcept
+    : _data(m._data), _size(m._size), _rucka(m._rucka)
+{
+    m._data = nullptr;
+    m._size = 0;
+    m._rucka = nullptr;
+}
+
+// Dodela pomeranjem; izvor ostaje prazan
+mapa& mapa::operator=(mapa&& m) noexcept
+{
+    if (this != &m){
+        zatvori();
+
+        _data = m._data;
+        _size = m._size;
+        _rucka = m._rucka;
+
+        m._data = nullptr;
+        m._size = 0;
+        m._rucka = nullptr;
+    }
+
+    return *this;
+}
+
+// Dohvatac za pocetak sadrzaja
+const char* mapa::data() const
+{
+    return _data;
+}
+
+// Dohvatac za velicinu sadrzaja
+Velicina mapa::size() const
+{
+    return _size;
+}
+
+}
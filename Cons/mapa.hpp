@@ -0,0 +1,50 @@
+#ifndef MAPA_HPP
+#define MAPA_HPP
+
+#include <string>
+
+#include "alijasi.hpp"
+
+// Imenski prostor za geometriju
+namespace geom {
+
+// Datoteka mapirana u memoriju, samo za citanje;
+// sadrzaj se ne kopira, vec ga operativni sistem
+// ucitava po stranicama tek kada se pristupi, pa
+// ni vrlo velike datoteke ne zauzimaju radnu memoriju
+class mapa
+{
+public:
+    // Konstruktor sa putanjom do datoteke, u UTF-8
+    explicit mapa(const std::string&);
+
+    // Destruktor; uklanja mapiranje
+    ~mapa();
+
+    // Mapa se ne moze kopirati, ali se moze pomerati
+    mapa(const mapa&) = delete;
+    mapa& operator=(const mapa&) = delete;
+    mapa(mapa&&) noexcept;
+    mapa& operator=(mapa&&) noexcept;
+
+    // Dohvatac za pocetak sadrzaja
+    const char* data() const;
+
+    // Dohvatac za velicinu sadrzaja
+    Velicina size() const;
+
+private:
+    // Uklanjanje mapiranja
+    void zatvori();
+
+    // Pocetak i velicina sadrzaja
+    const char* _data = nullptr;
+    Velicina _size = 0;
+
+    // Rucka mapiranja na Windows-u
+    void* _rucka = nullptr;
+};
+
+}
+
+#endif // MAPA_HPP
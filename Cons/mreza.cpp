@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <cmath>
+
+#include "mreza.hpp"
+
+// Imenski prostor za geometriju; u ovoj
+// datoteci je prostorna mreza tacaka
+namespace geom {
+
+// Konstruktor sa velicinom celije
+mreza::mreza(const Element celija)
+    : _celija(celija)
+{
+    if (!(celija > 0)){
+        throw Exc("Celija mreze mora biti pozitivna!");
+    }
+}
+
+// Dodavanje tacke u njenu celiju
+Velicina mreza::dodaj(const tacka& t)
+{
+    const auto& k = t.koord();
+    const auto i = std::size(_tacke);
+
+    _celije[kljuc(indeks(k[0]), indeks(k[1]))].push_back(i);
+    _tacke.push_back(t);
+
+    return i;
+}
+
+// Praznjenje mreze
+void mreza::isprazni()
+{
+    _tacke.clear();
+    _celije.clear();
+}
+
+// Dohvatac za sve tacke
+const NizTacaka& mreza::tacke() const
+{
+    return _tacke;
+}
+
+// Dohvatac za broj tacaka
+Velicina mreza::size() const
+{
+    return std::size(_tacke);
+}
+
+// Dohvatac za velicinu celije
+Element mreza::celija() const
+{
+    return _celija;
+}
+
+// Najbliza tacka; pretrazuju se samo celije
+// koje seku okvir kruga datog poluprecnika
+Velicina mreza::najbliza(const tacka& t, const Element r) const
+{
+    const auto& k = t.koord();
+
+    auto rez = nema;
+    auto najmanje = r*r;
+    obidji({k[0] - r, k[1] - r, k[0] + r, k[1] + r},
+           [this, &k, &rez, &najmanje](const Velicina i)
+           {
+               const auto& p = _tacke[i].koord();
+               const auto dx = p[0] - k[0];
+               const auto dy = p[1] - k[1];
+               const auto d = dx*dx + dy*dy;
+               if (d < najmanje || (d == najmanje && i < rez)){
+                   rez = i;
+                   najmanje = d;
+               }
+           });
+
+    return rez;
+}
+
+// Tacke u okviru, redom dodavanja
+std::vector<Velicina> mreza::u_okviru(const Okvir& o) const
+{
+    std::vector<Velicina> rez;
+    obidji(o, [this, &o, &rez](const Velicina i)
+              {
+                  const auto& p = _tacke[i].koord();
+                  if (o.sadrzi(p[0], p[1])){
+                      rez.push_back(i);
+                  }
+              });
+
+    std::sort(std::begin(rez), std::end(rez));
+    return rez;
+}
+
+// Kljuc celije; indeksi se svode na 32 bita
+std::uint64_t mreza::kljuc(const std::int64_t x, const std::int64_t y)
+{
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32 |
+           static_cast<std::uint32_t>(y);
+}
+
+// Indeks celije, ogranicen na opseg kljuca
+std::int64_t mreza::indeks(const Element x) const
+{
+    constexpr Element granica = 1 << 30;
+    return static_cast<std::int64_t>(std::floor(std::clamp(x / _celija,
+                                                            -granica, granica)));
+}
+
+// Obilazak tacaka iz celija koje seku okvir; ako
+// okvir pokriva vise celija nego sto ih ima nepraznih,
+// brze je proci kroz neprazne celije nego kroz okvir
+template <typename Fja>
+void mreza::obidji(const Okvir& o, Fja f) const
+{
+    if (o.prazan() || _tacke.empty()){
+        return;
+    }
+
+    const auto x0 = indeks(o.min_x), x1 = indeks(o.max_x);
+    const auto y0 = indeks(o.min_y), y1 = indeks(o.max_y);
+
+    if (static_cast<double>(x1 - x0 + 1) * (y1 - y0 + 1) > std::size(_celije)){
+        for (const auto& [k, celija] : _celije){
+            const auto x = static_cast<std::int32_t>(k >> 32);
+            const auto y = static_cast<std::int32_t>(k);
+            if (x0 <= x && x <= x1 && y0 <= y && y <= y1){
+                std::for_each(std::cbegin(celija), std::cend(celija), f);
+            }
+        }
+        return;
+    }
+
+    for (auto x = x0; x <= x1; x++){
+        for (auto y = y0; y <= y1; y++){
+            const auto celija = _celije.find(kljuc(x, y));
+            if (celija != std::cend(_celije)){
+                std::for_each(std::cbegin(celija->second), std::cend(celija->second), f);
+            }
+        }
+    }
+}
+
+}
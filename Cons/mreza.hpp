@@ -0,0 +1,70 @@
+#ifndef MREZA_HPP
+#define MREZA_HPP
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "tacka.hpp"
+#include "okvir.hpp"
+
+// Imenski prostor za geometriju
+namespace geom {
+
+// Prostorno hesiranje tacaka u ravnomernu mrezu;
+// svaka tacka pripada jednoj celiji zadate velicine,
+// a cuvaju se samo neprazne celije, pa su upiti u
+// ogranicenom krugu ili okviru ocekivano O(1) po
+// celiji, nezavisno od ukupnog broja tacaka
+class mreza
+{
+public:
+    // Oznaka da nema trazene tacke
+    static constexpr Velicina nema = static_cast<Velicina>(-1);
+
+    // Konstruktor sa velicinom celije
+    explicit mreza(const Element);
+
+    // Dodavanje tacke; vraca njen redni broj
+    Velicina dodaj(const tacka&);
+
+    // Praznjenje mreze
+    void isprazni();
+
+    // Dohvatac za sve tacke, redom dodavanja
+    const NizTacaka& tacke() const;
+
+    // Dohvatac za broj tacaka
+    Velicina size() const;
+
+    // Dohvatac za velicinu celije
+    Element celija() const;
+
+    // Redni broj najblize tacke na rastojanju
+    // najvise datom, ili nema ako takve nema
+    Velicina najbliza(const tacka&, const Element) const;
+
+    // Redni brojevi tacaka u okviru
+    std::vector<Velicina> u_okviru(const Okvir&) const;
+
+private:
+    // Kljuc celije od njenih indeksa
+    static std::uint64_t kljuc(const std::int64_t, const std::int64_t);
+
+    // Indeks celije po jednoj osi
+    std::int64_t indeks(const Element) const;
+
+    // Obilazak tacaka iz celija koje seku okvir
+    template <typename Fja>
+    void obidji(const Okvir&, Fja) const;
+
+    // Velicina celije
+    Element _celija;
+
+    // Sve tacke i neprazne celije
+    NizTacaka _tacke;
+    std::unordered_map<std::uint64_t, std::vector<Velicina>> _celije;
+};
+
+}
+
+#endif // MREZA_HPP
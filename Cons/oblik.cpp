@@ -1,4 +1,8 @@
+#include <cmath>
+
 #include "oblik.hpp"
+#include "jezgro.hpp"
+#include "paralelno.hpp"
 
 // Imenski prostor za geometriju;
 // u ovoj datoteci su oblici
@@ -10,6 +14,41 @@ const NizTacaka& oblik::tacke() const
     return _tacke;
 }
 
+// Podrazumevani tip oblika
+Tip oblik::tip() const
+{
+    return Tip::poligon;
+}
+
+// Podrazumevana zatvorenost oblika
+bool oblik::zatvoren() const
+{
+    return true;
+}
+
+// Sacuvan okvir, izracunat po potrebi
+Okvir oblik::okvir() const
+{
+    if (!_okvir_vazi){
+        _okvir = racunaj_okvir();
+        _okvir_vazi = true;
+    }
+
+    return _okvir;
+}
+
+// Okvir svih tacaka oblika
+Okvir oblik::racunaj_okvir() const
+{
+    Okvir rez;
+    for (const auto& t : _tacke){
+        const auto& k = t.koord();
+        rez.prosiri(k[0], k[1]);
+    }
+
+    return rez;
+}
+
 // Transformacija oblika
 void oblik::transformisi(const geom& g)
 {
@@ -19,9 +58,63 @@ void oblik::transformisi(const geom& g)
                             std::placeholders::_1,
                             g));*/
 
-    for (auto& tacka : _tacke){
+    /*for (auto& tacka : _tacke){
         tacka.primeni(g);
+    }*/
+
+    // Paketna primena u jednom prolazu
+    primeni(g, _tacke);
+    transformisi_okvir(g);
+}
+
+// Paralelna transformacija oblika
+void oblik::transformisi(const geom& g, bazen& b)
+{
+    primeni(g, _tacke, b);
+    transformisi_okvir(g);
+}
+
+// Preslikavanje sacuvanog okvira; ako preslikavanje
+// cuva pravce osa (skaliranje, translacija, rotacija
+// za prav ugao), slika okvira je okvir slike, do na
+// gresku zaokruzivanja, pa se dobija iz dva temena
+void oblik::transformisi_okvir(const geom& g)
+{
+    if (!_okvir_vazi || _okvir.prazan()){
+        return;
+    }
+
+    const auto& k = g.koef();
+    const auto& o = _okvir;
+
+    Okvir rez;
+    if (k[1] == 0 && k[3] == 0){
+        rez.prosiri(k[0]*o.min_x + k[2], k[4]*o.min_y + k[5]);
+        rez.prosiri(k[0]*o.max_x + k[2], k[4]*o.max_y + k[5]);
+    } else if (k[0] == 0 && k[4] == 0){
+        rez.prosiri(k[1]*o.min_y + k[2], k[3]*o.min_x + k[5]);
+        rez.prosiri(k[1]*o.max_y + k[2], k[3]*o.max_x + k[5]);
+    } else {
+        ponisti_okvir();
+        return;
     }
+
+    _okvir = rez;
+}
+
+// Prosirivanje sacuvanog okvira tackom
+void oblik::prosiri_okvir(const tacka& t)
+{
+    if (_okvir_vazi){
+        const auto& k = t.koord();
+        _okvir.prosiri(k[0], k[1]);
+    }
+}
+
+// Ponistavanje sacuvanog okvira
+void oblik::ponisti_okvir()
+{
+    _okvir_vazi = false;
 }
 
 // Konstruktor od l-vektora
@@ -71,19 +164,31 @@ void poly::otvori()
 // Dodavanje l-tacke
 void poly::dodaj(const tacka& t)
 {
+    prosiri_okvir(t);
     _tacke.push_back(t);
 }
 
 // Dodavanje r-tacke
 void poly::dodaj(tacka&& t)
 {
+    prosiri_okvir(t);
     _tacke.push_back(std::move(t));
 }
 
-// Zamena konveksnim omotacem
+// Zamena konveksnim omotacem; tacke se
+// obradjuju u mestu, bez kopiranja niza;
+// krajnje tacke po osama su uvek temena
+// omota, pa sacuvan okvir i dalje vazi
 void poly::omot()
 {
-    _tacke = util::konv_omot(_tacke);
+    _tacke.erase(util::konv_omot(std::begin(_tacke), std::end(_tacke)),
+                 std::end(_tacke));
+}
+
+// Paralelna zamena konveksnim omotacem
+void poly::omot(bazen& b)
+{
+    ::geom::omot(_tacke, b);
 }
 
 // Konstruktor sa centrom i velicinama
@@ -132,6 +237,32 @@ elipsa::elipsa(const tacka& t1, const tacka& t2, const tacka& t3)
     _tacke.push_back(t3);
 }
 
+// Tip elipse
+Tip elipsa::tip() const
+{
+    return Tip::elipsa;
+}
+
+// Okvir elipse; tacke ose su krajevi dva
+// konjugovana poluprecnika u i v, pa je kriva
+// c + u cos t + v sin t, a njen najveci otklon
+// po svakoj osi je duzina odgovarajuceg reda
+Okvir elipsa::racunaj_okvir() const
+{
+    if (std::size(_tacke) != 3){
+        return oblik::racunaj_okvir();
+    }
+
+    const auto& c = _tacke[0].koord();
+    const auto& u = _tacke[1].koord();
+    const auto& v = _tacke[2].koord();
+
+    const auto dx = std::hypot(u[0] - c[0], v[0] - c[0]);
+    const auto dy = std::hypot(u[1] - c[1], v[1] - c[1]);
+
+    return {c[0] - dx, c[1] - dy, c[0] + dx, c[1] + dy};
+}
+
 
 // Konstruktor sa centrom i poluprecnikom
 krug::krug(const tacka& t, const Element e)
@@ -150,6 +281,32 @@ krug::krug(const tacka& t1, const tacka& t2)
     _tacke.push_back(t2);
 }
 
+// Tip kruga
+Tip krug::tip() const
+{
+    return Tip::krug;
+}
+
+// Okvir kruznice kroz drugu tacku
+Okvir krug::racunaj_okvir() const
+{
+    if (std::size(_tacke) != 2){
+        return oblik::racunaj_okvir();
+    }
+
+    const auto& c = _tacke[0].koord();
+    const auto& t = _tacke[1].koord();
+    const auto r = std::hypot(t[0] - c[0], t[1] - c[1]);
+
+    return {c[0] - r, c[1] - r, c[0] + r, c[1] + r};
+}
+
+// Ponistavanje okvira kruga
+void krug::transformisi_okvir(const geom&)
+{
+    ponisti_okvir();
+}
+
 /***** OVO SAMO AKO BAS BUDE VREMENA ******************
 // Konstruktor sa putanjom i centrom
 slika::slika(const std::string& put, const tacka& t)
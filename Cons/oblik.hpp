@@ -1,13 +1,26 @@
 #ifndef OBLIK_HPP
 #define OBLIK_HPP
 
+#include <cstdint>
 #include <vector>
 
 #include "tacka.hpp"
+#include "okvir.hpp"
 
 // Imenski prostor za geometriju
 namespace geom {
 
+// Obecavajuca deklaracija bazena niti
+class bazen;
+
+// Tip oblika u sceni
+enum class Tip : std::uint8_t
+{
+    poligon,
+    elipsa,
+    krug
+};
+
 // Maksimalno svedena reprezentacija oblika
 // koje je moguce nacrtati na platnu; mogli
 // bi se implementirati razni metodi po ugledu
@@ -22,16 +35,53 @@ public:
     // Dohvatac za tacke
     const NizTacaka& tacke() const;
 
+    // Tip oblika; pravilan mnogougao i
+    // ostali oblici racunaju se kao poligon
+    virtual Tip tip() const;
+
+    // Dohvatac za zatvorenost; podrazumevano
+    // su oblici zatvoreni, a poligon to pamti
+    virtual bool zatvoren() const;
+
+    // Pravougaoni okvir oblika; cuva se, a posle
+    // izmene tacaka se lenjo racuna iznova
+    Okvir okvir() const;
+
     // Transformacija oblika
     void transformisi(const geom&);
 
+    // Paralelna transformacija oblika
+    void transformisi(const geom&, bazen&);
+
 protected:
     // Konstruktori od vektora
     oblik(const NizTacaka&);
     oblik(NizTacaka&& = {});
 
+    // Racunanje okvira; podrazumevano
+    // je to okvir svih tacaka oblika
+    virtual Okvir racunaj_okvir() const;
+
+    // Azuriranje sacuvanog okvira posle
+    // transformacije; okvir se preslikava
+    // ako je to moguce, a inace ponistava
+    virtual void transformisi_okvir(const geom&);
+
+    // Prosirivanje sacuvanog okvira tackom
+    void prosiri_okvir(const tacka&);
+
+    // Ponistavanje sacuvanog okvira
+    void ponisti_okvir();
+
     // Uredjeni niz tacaka oblika
     NizTacaka _tacke;
+
+private:
+    // Sacuvan okvir i indikator da vazi; menjaju
+    // se i iz konstantnog dohvataca, pa prvi poziv
+    // ne sme biti istovremeno iz vise niti
+    mutable Okvir _okvir;
+    mutable bool _okvir_vazi = false;
 };
 
 // Mnogougao ili poligonska linija
@@ -46,7 +96,7 @@ public:
     poly(const std::initializer_list<tacka>);
 
     // Dohvatac za zatvorenost
-    bool zatvoren() const;
+    bool zatvoren() const override;
 
     // Zatvaranje i otvaranje
     void zatvori();
@@ -59,6 +109,9 @@ public:
     // Zamena konveksnim omotacem
     void omot();
 
+    // Paralelna zamena konveksnim omotacem
+    void omot(bazen&);
+
 private:
     // Indikator zatvorenosti
     bool _zatvoren = false;
@@ -83,6 +136,12 @@ public:
     // Konstruktor sa trima glavnim tackama
     elipsa(const tacka&, const tacka&, const tacka&);
 
+    // Tip oblika
+    Tip tip() const override;
+
+protected:
+    // Okvir cele krive, a ne samo tacaka
+    Okvir racunaj_okvir() const override;
 };
 
 // Krug
@@ -95,6 +154,16 @@ public:
     // Konstruktor sa dvema glavnim tackama
     krug(const tacka&, const tacka&);
 
+    // Tip oblika
+    Tip tip() const override;
+
+protected:
+    // Okvir cele kruznice
+    Okvir racunaj_okvir() const override;
+
+    // Krug ostaje krug i posle transformacije
+    // koja to ne cuva, pa se okvir ponistava
+    void transformisi_okvir(const geom&) override;
 };
 
 /***** OVO SAMO AKO BAS BUDE VREMENA ******************
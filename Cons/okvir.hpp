@@ -0,0 +1,112 @@
+#ifndef OKVIR_HPP
+#define OKVIR_HPP
+
+#include <algorithm>
+#include <limits>
+
+#include "alijasi.hpp"
+
+// Imenski prostor za geometriju
+namespace geom {
+
+// Pravougaoni okvir poravnat sa osama; prazan
+// okvir ima obrnute granice, pa ga prosirivanje
+// prvom tackom svodi bas na tu tacku; metodi su
+// u zaglavlju jer se pozivaju u najuzim petljama
+struct Okvir
+{
+    // Granice okvira
+    Element min_x = std::numeric_limits<Element>::infinity();
+    Element min_y = std::numeric_limits<Element>::infinity();
+    Element max_x = -std::numeric_limits<Element>::infinity();
+    Element max_y = -std::numeric_limits<Element>::infinity();
+
+    // Provera praznine
+    bool prazan() const
+    {
+        return !(min_x <= max_x && min_y <= max_y);
+    }
+
+    // Prosirivanje tackom
+    void prosiri(const Element x, const Element y)
+    {
+        min_x = std::min(min_x, x);
+        min_y = std::min(min_y, y);
+        max_x = std::max(max_x, x);
+        max_y = std::max(max_y, y);
+    }
+
+    // Prosirivanje drugim okvirom
+    void prosiri(const Okvir& o)
+    {
+        min_x = std::min(min_x, o.min_x);
+        min_y = std::min(min_y, o.min_y);
+        max_x = std::max(max_x, o.max_x);
+        max_y = std::max(max_y, o.max_y);
+    }
+
+    // Provera preseka sa drugim okvirom
+    bool sece(const Okvir& o) const
+    {
+        return min_x <= o.max_x && o.min_x <= max_x &&
+               min_y <= o.max_y && o.min_y <= max_y;
+    }
+
+    // Provera sadrzavanja tacke
+    bool sadrzi(const Element x, const Element y) const
+    {
+        return min_x <= x && x <= max_x &&
+               min_y <= y && y <= max_y;
+    }
+
+    // Provera sadrzavanja drugog okvira
+    bool sadrzi(const Okvir& o) const
+    {
+        return min_x <= o.min_x && o.max_x <= max_x &&
+               min_y <= o.min_y && o.max_y <= max_y;
+    }
+
+    // Povrsina okvira
+    Element povrsina() const
+    {
+        return prazan() ? 0 : (max_x - min_x) * (max_y - min_y);
+    }
+
+    // Poluobim okvira
+    Element poluobim() const
+    {
+        return prazan() ? 0 : (max_x - min_x) + (max_y - min_y);
+    }
+
+    // Kvadrat rastojanja do tacke; nula
+    // ako je tacka u samom okviru
+    Element rastojanje2(const Element x, const Element y) const
+    {
+        const auto dx = std::max({min_x - x, Element(0), x - max_x});
+        const auto dy = std::max({min_y - y, Element(0), y - max_y});
+        return dx*dx + dy*dy;
+    }
+};
+
+// Najmanji okvir koji sadrzi oba okvira
+inline Okvir spoj(Okvir a, const Okvir& b)
+{
+    a.prosiri(b);
+    return a;
+}
+
+// Poredjenje okvira
+inline bool operator==(const Okvir& a, const Okvir& b)
+{
+    return a.min_x == b.min_x && a.min_y == b.min_y &&
+           a.max_x == b.max_x && a.max_y == b.max_y;
+}
+
+inline bool operator!=(const Okvir& a, const Okvir& b)
+{
+    return !(a == b);
+}
+
+}
+
+#endif // OKVIR_HPP
@@ -0,0 +1,370 @@
+#include <cstring>
+#include <iterator>
+#include <memory>
+
+#include "paralelno.hpp"
+#include "jezgro.hpp"
+
+// Imenski prostor za geometriju; u ovoj
+// datoteci je paralelna obrada transformacija
+namespace geom {
+
+namespace {
+
+// Indikator da tekuca nit vec izvrsava posao
+// nekog bazena; ugnjezdeni poslovi se tada
+// izvrsavaju serijski, kako ne bi doslo do
+// uzajamnog blokiranja (deadlock)
+thread_local bool u_poslu = false;
+
+// Najmanji broj tacaka u jednom delu niza;
+// manji nizovi se obradjuju serijski, jer
+// bi cena sinhronizacije bila veca od dobiti
+constexpr Velicina prag = 1 << 14;
+
+// Broj delova po niti, radi ravnomernijeg
+// rasporeda posla medju nitima
+constexpr Velicina delova_po_niti = 4;
+
+// Najmanji broj bajtova u jednom delu
+// tekstualne scene koji se parsira zasebno
+constexpr Velicina prag_bajtova = 1 << 20;
+
+// Broj zadataka potreban za n stavki
+// podeljenih u grupe date velicine
+Velicina zadataka(const Velicina n, const Velicina grupa)
+{
+    return (n + grupa - 1) / grupa;
+}
+
+}
+
+// Konstruktor sa brojem pomocnih niti; prazan
+// bazen sve poslove izvrsava u pozivajucoj niti
+bazen::bazen(const Velicina n)
+{
+    for (Velicina i = 1; i < n; i++){
+        _niti.emplace_back(&bazen::radi, this);
+    }
+}
+
+// Destruktor; zaustavlja i ceka sve niti
+bazen::~bazen()
+{
+    {
+        std::lock_guard<std::mutex> brava(_mutex);
+        _kraj = true;
+    }
+
+    _novi.notify_all();
+
+    for (auto& nit : _niti){
+        nit.join();
+    }
+}
+
+// Dohvatac za broj niti
+Velicina bazen::size() const
+{
+    return std::size(_niti) + 1;
+}
+
+// Izvrsavanje zadataka na svim nitima
+void bazen::izvrsi(const Velicina n, const std::function<void(Velicina)>& f)
+{
+    // Serijsko izvrsavanje ako nema pomocnih
+    // niti, ako je posao jedan jedini zadatak
+    // ili ako je u pitanju ugnjezdeni posao
+    if (_niti.empty() || n <= 1 || u_poslu){
+        for (Velicina i = 0; i < n; i++){
+            f(i);
+        }
+        return;
+    }
+
+    // Jedan po jedan posao u bazenu
+    std::lock_guard<std::mutex> posao(_posao);
+
+    // Postavljanje novog posla
+    {
+        std::lock_guard<std::mutex> brava(_mutex);
+        _zadatak = &f;
+        _sledeci = 0;
+        _ukupno = n;
+        _zavrseno = 0;
+        _greska = nullptr;
+        _generacija++;
+    }
+
+    // Budjenje pomocnih niti i ucestvovanje
+    _novi.notify_all();
+    obradi();
+
+    // Cekanje da se zavrse svi zadaci
+    std::unique_lock<std::mutex> brava(_mutex);
+    _gotov.wait(brava, [this]{return _zavrseno == _ukupno;});
+    _zadatak = nullptr;
+
+    // Prosledjivanje eventualne greske
+    if (_greska){
+        std::rethrow_exception(_greska);
+    }
+}
+
+// Petlja pomocne niti
+void bazen::radi()
+{
+    Velicina vidjena = 0;
+
+    while (true){
+        // Cekanje novog posla ili gasenja
+        {
+            std::unique_lock<std::mutex> brava(_mutex);
+            _novi.wait(brava, [this, &vidjena]
+                              {return _kraj || _generacija != vidjena;});
+
+            if (_kraj){
+                return;
+            }
+
+            vidjena = _generacija;
+        }
+
+        obradi();
+    }
+}
+
+// Uzimanje i izvrsavanje zadataka dok ih ima
+void bazen::obradi()
+{
+    const auto prethodno = u_poslu;
+    u_poslu = true;
+
+    while (true){
+        // Uzimanje sledeceg zadatka
+        const std::function<void(Velicina)>* f;
+        Velicina i;
+        {
+            std::lock_guard<std::mutex> brava(_mutex);
+            if (_zadatak == nullptr || _sledeci == _ukupno){
+                break;
+            }
+
+            f = _zadatak;
+            i = _sledeci++;
+        }
+
+        // Izvrsavanje van zakljucavanja; pamti
+        // se samo prvi izuzetak koji se javi
+        std::exception_ptr greska;
+        try{
+            (*f)(i);
+        } catch (...){
+            greska = std::current_exception();
+        }
+
+        // Belezenje zavrsetka zadatka
+        std::lock_guard<std::mutex> brava(_mutex);
+        if (greska && !_greska){
+            _greska = greska;
+        }
+
+        if (++_zavrseno == _ukupno){
+            _gotov.notify_all();
+        }
+    }
+
+    u_poslu = prethodno;
+}
+
+// Podrazumevani bazen niti; cuva se kao
+// pokazivac kako bi se mogao zameniti
+static std::unique_ptr<bazen>& podrazumevani()
+{
+    static auto b = std::make_unique<bazen>();
+    return b;
+}
+
+// Dohvatac podrazumevanog bazena niti
+bazen& niti()
+{
+    return *podrazumevani();
+}
+
+// Promena broja niti podrazumevanog bazena
+void niti(const Velicina n)
+{
+    podrazumevani() = std::make_unique<bazen>(n);
+}
+
+// Paralelna primena transformacije na niz tacaka;
+// delovi su uzastopni i velicine deljive sa osam,
+// pa se svaka tacka racuna istim jezgrom kao i
+// u serijskom slucaju, tj. rezultat je identican
+void primeni(const geom& g, NizTacaka& tacke, bazen& b)
+{
+    const auto n = std::size(tacke);
+
+    // Velicina jednog dela niza
+    auto deo = std::max(prag, zadataka(n, b.size()*delova_po_niti));
+    deo = zadataka(deo, 8) * 8;
+
+    b.izvrsi(zadataka(n, deo),
+             [&g, &tacke, n, deo](const Velicina i)
+             {
+                 const auto od = i*deo;
+                 primeni(g, std::data(tacke)+od, std::min(deo, n-od));
+             });
+}
+
+// Paralelna transformacija vise oblika
+void transformisi(const geom& g, const std::vector<oblik*>& oblici, bazen& b)
+{
+    // Veliki oblici se obradjuju jedan po jedan,
+    // deljenjem niza tacaka, a mali se odvajaju
+    std::vector<oblik*> mali;
+    for (auto o : oblici){
+        if (std::size(o->tacke()) >= prag){
+            o->transformisi(g, b);
+        } else {
+            mali.push_back(o);
+        }
+    }
+
+    // Mali oblici se grupisu u zadatke
+    const auto n = std::size(mali);
+    const auto grupa = std::max(Velicina(1),
+                                zadataka(n, b.size()*delova_po_niti));
+
+    b.izvrsi(zadataka(n, grupa),
+             [&g, &mali, n, grupa](const Velicina i)
+             {
+                 const auto kraj = std::min(n, (i+1)*grupa);
+                 for (auto j = i*grupa; j < kraj; j++){
+                     mali[j]->transformisi(g);
+                 }
+             });
+}
+
+// Paralelni konveksni omot; svaki deo niza se u
+// mestu svodi na svoj omot, omoti delova se sabijaju
+// na pocetak niza, a konacni omot se racuna samo nad
+// njima; kako su temena omota celog niza sigurno
+// temena omota svog dela, rezultat i njegov poredak
+// su isti kao u serijskom slucaju
+void omot(NizTacaka& tacke, bazen& b)
+{
+    const auto n = std::size(tacke);
+    const auto pocetak = std::begin(tacke);
+
+    // Velicina jednog dela niza
+    const auto deo = std::max(prag, zadataka(n, b.size()*delova_po_niti));
+    const auto delova = zadataka(n, deo);
+
+    // Omoti delova, pamti se samo kraj svakog
+    std::vector<Velicina> krajevi(delova);
+    b.izvrsi(delova,
+             [&krajevi, pocetak, n, deo](const Velicina i)
+             {
+                 const auto od = pocetak + i*deo;
+                 const auto kraj = pocetak + std::min(n, (i+1)*deo);
+                 krajevi[i] = util::konv_omot(od, kraj) - pocetak;
+             });
+
+    // Sabijanje omota delova na pocetak niza; prvi
+    // je vec na mestu, a izbegava se i pomeranje
+    // tacke same u sebe, koje bi je ispraznilo
+    auto kraj = pocetak + (delova ? krajevi[0] : 0);
+    for (Velicina i = 1; i < delova; i++){
+        const auto od = pocetak + i*deo;
+        kraj = kraj == od ? pocetak + krajevi[i]
+                          : std::move(od, pocetak + krajevi[i], kraj);
+    }
+
+    // Konacni omot od omota delova
+    tacke.erase(util::konv_omot(pocetak, kraj), std::end(tacke));
+}
+
+// Paralelno ucitavanje tekstualne scene; granica
+// dela se pomera iza prvog sledeceg znaka za novi
+// red, pa se nijedan red ne deli izmedju dva dela
+Scena ucitaj_tekst(const std::string& putanja, bazen& b)
+{
+    const mapa datoteka(putanja);
+    const auto pocetak = datoteka.data();
+    const auto n = datoteka.size();
+
+    // Granice delova, na pocecima redova
+    const auto deo = std::max(prag_bajtova, zadataka(n, b.size()*delova_po_niti));
+    std::vector<Velicina> granice{0};
+    for (auto g = deo; g < n; g = std::max(g, granice.back()) + deo){
+        const auto red = static_cast<const char*>(std::memchr(pocetak + g, '\n', n - g));
+        if (red == nullptr){
+            break;
+        }
+        granice.push_back(red + 1 - pocetak);
+    }
+    granice.push_back(n);
+
+    // Parsiranje delova, svaki u svoju scenu
+    const auto delova = std::size(granice) - 1;
+    std::vector<Scena> scene(delova);
+    try {
+        b.izvrsi(delova,
+                 [&scene, &granice, pocetak](const Velicina i)
+                 {
+                     citaj_tekst(pocetak + granice[i], pocetak + granice[i+1],
+                                 [&scena = scene[i]](std::unique_ptr<oblik> o)
+                                 {
+                                     scena.push_back(std::move(o));
+                                 });
+                 });
+    } catch (const Exc&){
+        // Brojevi redova u delu nisu apsolutni, pa
+        // se greska ponovo trazi serijski, kako bi
+        // se prijavila prva, sa tacnim brojem reda
+        citaj_tekst(pocetak, pocetak + n, [](std::unique_ptr<oblik>){});
+        throw;
+    }
+
+    // Spajanje delova redom
+    Velicina ukupno = 0;
+    for (const auto& scena : scene){
+        ukupno += std::size(scena);
+    }
+
+    Scena rez;
+    rez.reserve(ukupno);
+    for (auto& scena : scene){
+        std::move(std::begin(scena), std::end(scena), std::back_inserter(rez));
+    }
+
+    return rez;
+}
+
+// Paralelno ucitavanje binarne scene; svaki
+// oblik ima unapred odredjeno mesto u rezultatu
+Scena ucitaj_binarno(const std::string& putanja, bazen& b)
+{
+    const binarna_scena scena(putanja);
+    const auto n = scena.size();
+
+    // Oblici se grupisu u zadatke, kao
+    // pri transformaciji malih oblika
+    const auto grupa = std::max(Velicina(1),
+                                zadataka(n, b.size()*delova_po_niti));
+
+    Scena rez(n);
+    b.izvrsi(zadataka(n, grupa),
+             [&scena, &rez, n, grupa](const Velicina i)
+             {
+                 const auto kraj = std::min(n, (i+1)*grupa);
+                 for (auto j = i*grupa; j < kraj; j++){
+                     rez[j] = scena.kopija(j);
+                 }
+             });
+
+    return rez;
+}
+
+}
@@ -0,0 +1,105 @@
+#ifndef PARALELNO_HPP
+#define PARALELNO_HPP
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+#include "oblik.hpp"
+#include "scena.hpp"
+
+// Imenski prostor za geometriju
+namespace geom {
+
+// Bazen niti za paralelnu obradu; niti se prave
+// jednom, pri konstrukciji, a zatim naizmenicno
+// cekaju i izvrsavaju poslove koji im se predaju
+class bazen
+{
+public:
+    // Konstruktor sa brojem pomocnih niti; nit
+    // koja predaje posao uvek i sama ucestvuje
+    explicit bazen(const Velicina = std::thread::hardware_concurrency());
+
+    // Destruktor; zaustavlja i ceka sve niti
+    ~bazen();
+
+    // Bazen se ne moze kopirati niti pomerati
+    bazen(const bazen&) = delete;
+    bazen& operator=(const bazen&) = delete;
+
+    // Dohvatac za broj niti, racunajuci i
+    // nit koja predaje posao bazenu
+    Velicina size() const;
+
+    // Izvrsavanje zadataka 0, 1, ..., n-1 na
+    // svim nitima; blokira do zavrsetka svih, a
+    // prvi izuzetak iz nekog zadatka se prosledjuje
+    void izvrsi(const Velicina, const std::function<void(Velicina)>&);
+
+private:
+    // Petlja pomocne niti
+    void radi();
+
+    // Uzimanje i izvrsavanje zadataka
+    void obradi();
+
+    // Pomocne niti bazena
+    std::vector<std::thread> _niti;
+
+    // Zakljucavanje stanja i
+    // jednog po jednog posla
+    std::mutex _mutex;
+    std::mutex _posao;
+
+    // Obavestenja o novom i
+    // o zavrsenom poslu
+    std::condition_variable _novi;
+    std::condition_variable _gotov;
+
+    // Trenutni posao i njegovo stanje
+    const std::function<void(Velicina)>* _zadatak = nullptr;
+    Velicina _sledeci = 0;
+    Velicina _ukupno = 0;
+    Velicina _zavrseno = 0;
+    Velicina _generacija = 0;
+    std::exception_ptr _greska;
+
+    // Indikator gasenja bazena
+    bool _kraj = false;
+};
+
+// Podrazumevani bazen niti, sa
+// onoliko niti koliko ima jezgara
+bazen& niti();
+
+// Promena broja niti podrazumevanog bazena;
+// ne sme se pozvati dok bazen radi
+void niti(const Velicina);
+
+// Paralelna primena transformacije na niz
+// tacaka, podeljen na uzastopne delove
+void primeni(const geom&, NizTacaka&, bazen&);
+
+// Paralelna transformacija vise oblika; veliki
+// oblici se dele na delove, a mali se grupisu
+void transformisi(const geom&, const std::vector<oblik*>&, bazen& = niti());
+
+// Paralelni konveksni omot niza tacaka; niz
+// se svodi na omot, u istom poretku kao serijski
+void omot(NizTacaka&, bazen& = niti());
+
+// Paralelno ucitavanje tekstualne scene; mapirana
+// datoteka se deli na delove na granicama redova,
+// delovi se parsiraju na svim nitima, a oblici se
+// spajaju redom kojim su zapisani
+Scena ucitaj_tekst(const std::string&, bazen&);
+
+// Paralelno ucitavanje binarne scene; oblici
+// se kopiraju iz mapirane datoteke u grupama
+Scena ucitaj_binarno(const std::string&, bazen&);
+
+}
+
+#endif // PARALELNO_HPP
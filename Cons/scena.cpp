@@ -0,0 +1,490 @@
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+
+#include "scena.hpp"
+
+// Imenski prostor za geometriju; u ovoj
+// datoteci su zapisi i formati scene
+namespace geom {
+
+namespace {
+
+// Magija na pocetku binarne datoteke
+constexpr char magija[8] = {'G', 'E', 'O', 'S', 'C', 'E', 'N', 'A'};
+
+// Trenutna verzija binarnog formata
+constexpr std::uint32_t verzija = 1;
+
+// Velicina dela datoteke za niz tacaka
+constexpr Velicina bajtova_po_tacki = 2 * sizeof(Element);
+
+// Binarni format se koristi direktno iz memorije,
+// bez obrtanja bajtova, pa je ispravan samo na
+// little-endian procesorima; gde prevodilac zna
+// redosled bajtova, proverava se pri prevodjenju,
+// a inace pri svakom citanju i pisanju datoteke
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+              "Binarna scena zahteva little-endian procesor!");
+#endif
+
+void proveri_redosled()
+{
+    const std::uint16_t jedan = 1;
+    unsigned char prvi;
+    std::memcpy(&prvi, &jedan, 1);
+    if (prvi != 1){
+        throw Exc("Binarna scena zahteva little-endian procesor!");
+    }
+}
+
+// Nazivi tipova u tekstualnom formatu
+constexpr const char* imena[] = {"poligon", "elipsa", "krug"};
+
+// Najduzi zapis jednog broja; i najveci broj
+// zapisan sa fiksnim brojem decimala staje
+constexpr Velicina najduzi_broj = 512;
+
+// Preskakanje razmaka unutar reda
+const char* preskoci(const char* p, const char* kraj)
+{
+    while (p != kraj && (*p == ' ' || *p == '\t' || *p == '\r')){
+        p++;
+    }
+
+    return p;
+}
+
+// Uzimanje ocekivanog znaka, ako ga ima
+bool uzmi(const char*& p, const char* kraj, const char c)
+{
+    p = preskoci(p, kraj);
+    if (p == kraj || *p != c){
+        return false;
+    }
+
+    p++;
+    return true;
+}
+
+// Citanje broja, bez alokacije i bez
+// zavisnosti od lokalnih podesavanja
+bool broj(const char*& p, const char* kraj, Element& x)
+{
+    p = preskoci(p, kraj);
+    const auto rez = std::from_chars(p, kraj, x);
+    if (rez.ec != std::errc()){
+        return false;
+    }
+
+    p = rez.ptr;
+    return true;
+}
+
+// Parsiranje jednog reda, bez znaka za novi
+// red; tacke se upisuju u zadati niz, koji se
+// zatim predaje napravljenom obliku
+bool parsiraj(const char* p, const char* kraj, Tip& t, NizTacaka& tacke)
+{
+    p = preskoci(p, kraj);
+    const auto dvotacka = static_cast<const char*>(std::memchr(p, ':', kraj - p));
+    if (dvotacka == nullptr){
+        return false;
+    }
+
+    // Naziv tipa pre dvotacke
+    const std::string_view naziv(p, dvotacka - p);
+    const auto nadjen = std::find(std::cbegin(imena), std::cend(imena), naziv);
+    if (nadjen == std::cend(imena)){
+        return false;
+    }
+    t = static_cast<Tip>(nadjen - std::cbegin(imena));
+
+    // Tacke oblika, [x, y] ili [x, y, z]
+    tacke.clear();
+    p = preskoci(dvotacka + 1, kraj);
+    while (p != kraj){
+        Element x, y, z = 1;
+        if (!uzmi(p, kraj, '[') || !broj(p, kraj, x) ||
+            !uzmi(p, kraj, ',') || !broj(p, kraj, y) ||
+            (uzmi(p, kraj, ',') && !broj(p, kraj, z)) ||
+            !uzmi(p, kraj, ']')){
+            return false;
+        }
+
+        // Uobicajena homogena koordinata ne
+        // zahteva ni proveru ni deljenje
+        if (z == 1){
+            tacke.emplace_back(x, y);
+        } else {
+            tacke.emplace_back(x, y, z);
+        }
+
+        if (!uzmi(p, kraj, ';') && (p = preskoci(p, kraj)) != kraj){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Citanje redova iz bafera; redovi se broje
+// od zadatog, radi poruke o gresci
+Velicina citaj_redove(const char* prvi, const char* poslednji,
+                      const Obrada& obrada, Velicina red)
+{
+    Velicina procitano = 0;
+    NizTacaka tacke;
+    Tip t;
+
+    while (prvi != poslednji){
+        red++;
+
+        auto kraj = static_cast<const char*>(std::memchr(prvi, '\n', poslednji - prvi));
+        if (kraj == nullptr){
+            kraj = poslednji;
+        }
+
+        // Prazni redovi se preskacu
+        if (preskoci(prvi, kraj) != kraj){
+            if (!parsiraj(prvi, kraj, t, tacke)){
+                throw Exc("Neispravan red " + std::to_string(red) + " tekstualne scene!");
+            }
+
+            // Greska pri pravljenju oblika se
+            // takodje prijavljuje uz broj reda
+            std::unique_ptr<oblik> o;
+            try {
+                o = napravi(t, std::move(tacke));
+            } catch (const Exc& e){
+                throw Exc("Neispravan red " + std::to_string(red) +
+                          " tekstualne scene: " + e.what());
+            }
+
+            obrada(std::move(o));
+            procitano++;
+        }
+
+        prvi = kraj == poslednji ? kraj : kraj + 1;
+    }
+
+    return procitano;
+}
+
+// Upis broja, bez alokacije
+char* upisi(char* p, char* kraj, const Element x, const Preciznost preciznost)
+{
+    const auto rez = preciznost == Preciznost::puna
+                   ? std::to_chars(p, kraj, x)
+                   : std::to_chars(p, kraj, x, std::chars_format::fixed, 2);
+    return rez.ptr;
+}
+
+}
+
+// Provera rasporeda binarnog formata
+static_assert(sizeof(binarno::Zaglavlje) == 32, "Zaglavlje nije 32 bajta!");
+static_assert(sizeof(binarno::Zapis) == 16, "Zapis nije 16 bajtova!");
+
+// Pravljenje oblika datog tipa
+std::unique_ptr<oblik> napravi(const Tip t, NizTacaka&& tacke, const bool zatvoren)
+{
+    switch (t){
+    case Tip::poligon:
+    {
+        auto p = std::make_unique<poly>(std::move(tacke));
+        if (zatvoren){
+            p->zatvori();
+        }
+        return p;
+    }
+
+    case Tip::elipsa:
+        if (std::size(tacke) != 3){
+            throw Exc("Elipsa nema tri tacke!");
+        }
+        return std::make_unique<elipsa>(tacke[0], tacke[1], tacke[2]);
+
+    case Tip::krug:
+        if (std::size(tacke) != 2){
+            throw Exc("Krug nema dve tacke!");
+        }
+        return std::make_unique<krug>(tacke[0], tacke[1]);
+    }
+
+    throw Exc("Nepoznat tip oblika!");
+}
+
+// Naziv tipa u tekstualnom formatu
+const char* ime(const Tip t)
+{
+    return imena[static_cast<std::size_t>(t)];
+}
+
+// Postepeno citanje tekstualne scene; red
+// se cita u isti bafer i odmah parsira
+Velicina citaj_tekst(std::istream& in, const Obrada& obrada)
+{
+    Velicina red = 0;
+    Velicina procitano = 0;
+    std::string linija;
+
+    while (std::getline(in, linija)){
+        procitano += citaj_redove(std::data(linija),
+                                  std::data(linija) + std::size(linija),
+                                  obrada, red++);
+    }
+
+    if (in.bad()){
+        throw Exc("Nije moguce procitati tekstualnu scenu!");
+    }
+
+    return procitano;
+}
+
+// Citanje tekstualne scene iz bafera
+Velicina citaj_tekst(const char* prvi, const char* poslednji, const Obrada& obrada)
+{
+    return citaj_redove(prvi, poslednji, obrada, 0);
+}
+
+// Ucitavanje tekstualne scene mapiranjem
+// datoteke, bez kopiranja njenog sadrzaja
+Velicina ucitaj_tekst(const std::string& putanja, const Obrada& obrada)
+{
+    const mapa datoteka(putanja);
+    return citaj_tekst(datoteka.data(), datoteka.data() + datoteka.size(), obrada);
+}
+
+// Upis jednog oblika u tekstualnom formatu;
+// svaka tacka se slaze u bafer na steku
+void pisi_tekst(std::ostream& out, const oblik& o, const Preciznost preciznost)
+{
+    out << ime(o.tip()) << ':';
+
+    char bafer[2 * najduzi_broj];
+    const auto kraj = bafer + sizeof bafer;
+
+    const auto& tacke = o.tacke();
+    for (Velicina i = 0; i < std::size(tacke); i++){
+        auto p = bafer;
+        if (i != 0){
+            *p++ = ';';
+        }
+
+        *p++ = '[';
+        p = upisi(p, kraj, tacke[i][0], preciznost);
+        *p++ = ',';
+        *p++ = ' ';
+        p = upisi(p, kraj, tacke[i][1], preciznost);
+        p = std::copy_n(", 1.00]", 7, p);
+
+        out.write(bafer, p - bafer);
+    }
+
+    out << '\n';
+}
+
+// Cuvanje scene u tekstualnom formatu; stanje
+// toka se proverava tek posle svih oblika, jer
+// greska pri upisu ostaje zabelezena u toku
+void sacuvaj_tekst(const std::string& putanja, const std::vector<const oblik*>& oblici,
+                   const Preciznost preciznost)
+{
+    std::ofstream datoteka(std::filesystem::u8path(putanja));
+    if (!datoteka){
+        throw Exc("Nije moguce otvoriti " + putanja + "!");
+    }
+
+    for (const auto o : oblici){
+        pisi_tekst(datoteka, *o, preciznost);
+    }
+
+    datoteka.close();
+    if (!datoteka){
+        throw Exc("Nije moguce sacuvati " + putanja + "!");
+    }
+}
+
+// Otvaranje binarne scene; proverava se da
+// su zaglavlje i tabela ispravni i da u datoteci
+// ima tacno onoliko koordinata koliko je najavljeno
+binarna_scena::binarna_scena(const std::string& putanja)
+    : _mapa(putanja)
+{
+    proveri_redosled();
+
+    const auto velicina = _mapa.size();
+    if (velicina < sizeof(binarno::Zaglavlje)){
+        throw Exc("Datoteka nije binarna scena!");
+    }
+
+    _zaglavlje = reinterpret_cast<const binarno::Zaglavlje*>(_mapa.data());
+    if (std::memcmp(_zaglavlje->magija, magija, sizeof magija) != 0){
+        throw Exc("Datoteka nije binarna scena!");
+    }
+
+    if (_zaglavlje->verzija != verzija){
+        throw Exc("Nepodrzana verzija binarne scene!");
+    }
+
+    // Provera velicine, bez prekoracenja
+    const auto ostatak = velicina - sizeof(binarno::Zaglavlje);
+    const auto oblika = _zaglavlje->oblika;
+    const auto tacaka = _zaglavlje->tacaka;
+    if (oblika > ostatak / sizeof(binarno::Zapis) ||
+        tacaka > (ostatak - oblika * sizeof(binarno::Zapis)) / bajtova_po_tacki ||
+        ostatak != oblika * sizeof(binarno::Zapis) + tacaka * bajtova_po_tacki){
+        throw Exc("Neispravna velicina binarne scene!");
+    }
+
+    _zapisi = reinterpret_cast<const binarno::Zapis*>(_zaglavlje + 1);
+    _koordinate = reinterpret_cast<const Element*>(_zapisi + oblika);
+
+    // Provera tabele oblika
+    for (Velicina i = 0; i < oblika; i++){
+        const auto& z = _zapisi[i];
+        if (z.prva > tacaka || z.broj > tacaka - z.prva ||
+            z.tip > Tip::krug){
+            throw Exc("Neispravan oblik " + std::to_string(i) + " binarne scene!");
+        }
+    }
+}
+
+// Dohvatac za broj oblika
+Velicina binarna_scena::size() const
+{
+    return _zaglavlje->oblika;
+}
+
+// Dohvatac za ukupan broj tacaka
+Velicina binarna_scena::tacaka() const
+{
+    return _zaglavlje->tacaka;
+}
+
+// Dohvatac za tip oblika
+Tip binarna_scena::tip(const Velicina i) const
+{
+    return _zapisi[i].tip;
+}
+
+// Dohvatac za zatvorenost oblika
+bool binarna_scena::zatvoren(const Velicina i) const
+{
+    return _zapisi[i].zatvoren != 0;
+}
+
+// Dohvatac za broj tacaka oblika
+Velicina binarna_scena::tacaka(const Velicina i) const
+{
+    return _zapisi[i].broj;
+}
+
+// Koordinate tacaka oblika
+const Element* binarna_scena::koordinate(const Velicina i) const
+{
+    return _koordinate + 2 * _zapisi[i].prva;
+}
+
+// Kopija tacaka oblika
+NizTacaka binarna_scena::tacke(const Velicina i) const
+{
+    const auto k = koordinate(i);
+    const auto n = tacaka(i);
+
+    NizTacaka rez;
+    rez.reserve(n);
+    for (Velicina j = 0; j < n; j++){
+        rez.emplace_back(k[2*j], k[2*j+1]);
+    }
+
+    return rez;
+}
+
+// Kopija oblika
+std::unique_ptr<oblik> binarna_scena::kopija(const Velicina i) const
+{
+    return napravi(tip(i), tacke(i), zatvoren(i));
+}
+
+// Cuvanje scene u binarnom formatu
+void sacuvaj_binarno(const std::string& putanja, const std::vector<const oblik*>& oblici)
+{
+    proveri_redosled();
+
+    // Ukupan broj tacaka
+    Velicina tacaka = 0;
+    for (const auto o : oblici){
+        tacaka += std::size(o->tacke());
+    }
+
+    // Bafer za celu datoteku
+    const auto oblika = std::size(oblici);
+    std::vector<char> bafer(sizeof(binarno::Zaglavlje) +
+                            oblika * sizeof(binarno::Zapis) +
+                            tacaka * bajtova_po_tacki);
+
+    // Zaglavlje
+    binarno::Zaglavlje zaglavlje{};
+    std::memcpy(zaglavlje.magija, magija, sizeof magija);
+    zaglavlje.verzija = verzija;
+    zaglavlje.oblika = oblika;
+    zaglavlje.tacaka = tacaka;
+    std::memcpy(std::data(bafer), &zaglavlje, sizeof zaglavlje);
+
+    // Tabela oblika i koordinate
+    auto zapis = std::data(bafer) + sizeof(binarno::Zaglavlje);
+    auto koordinate = zapis + oblika * sizeof(binarno::Zapis);
+    Velicina prva = 0;
+    for (const auto o : oblici){
+        const auto& tacke = o->tacke();
+        if (std::size(tacke) > UINT32_MAX){
+            throw Exc("Oblik ima previse tacaka!");
+        }
+
+        binarno::Zapis z{};
+        z.prva = prva;
+        z.broj = static_cast<std::uint32_t>(std::size(tacke));
+        z.tip = o->tip();
+        z.zatvoren = o->zatvoren();
+        std::memcpy(zapis, &z, sizeof z);
+        zapis += sizeof z;
+
+        for (const auto& t : tacke){
+            std::memcpy(koordinate, std::data(t.koord()), bajtova_po_tacki);
+            koordinate += bajtova_po_tacki;
+        }
+
+        prva += std::size(tacke);
+    }
+
+    // Upis u jednom potezu; putanja je u UTF-8, kao
+    // i pri citanju, pa se tako i tumaci na Windows-u
+    std::ofstream datoteka(std::filesystem::u8path(putanja),
+                           std::ios::binary | std::ios::trunc);
+    datoteka.write(std::data(bafer), static_cast<std::streamsize>(std::size(bafer)));
+    if (!datoteka){
+        throw Exc("Nije moguce sacuvati " + putanja + "!");
+    }
+}
+
+// Ucitavanje cele binarne scene
+Scena ucitaj_binarno(const std::string& putanja)
+{
+    const binarna_scena scena(putanja);
+
+    Scena rez;
+    rez.reserve(scena.size());
+    for (Velicina i = 0; i < scena.size(); i++){
+        rez.push_back(scena.kopija(i));
+    }
+
+    return rez;
+}
+
+}
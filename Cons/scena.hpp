@@ -0,0 +1,141 @@
+#ifndef SCENA_HPP
+#define SCENA_HPP
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+
+#include "oblik.hpp"
+#include "mapa.hpp"
+
+// Imenski prostor za geometriju
+namespace geom {
+
+// Pravljenje oblika datog tipa od niza tacaka;
+// zatvorenost se odnosi samo na poligone
+std::unique_ptr<oblik> napravi(const Tip, NizTacaka&&, const bool = true);
+
+// Naziv tipa u tekstualnom formatu
+const char* ime(const Tip);
+
+// Scena kao uredjeni niz oblika
+using Scena = std::vector<std::unique_ptr<oblik>>;
+
+// Obrada jednog procitanog oblika
+using Obrada = std::function<void(std::unique_ptr<oblik>)>;
+
+// Tekstualni format scene, jedan oblik po redu:
+//   tip:[x, y, 1.00];[x, y, 1.00];...
+// citanje je postepeno, oblik po oblik, pa je
+// u memoriji najvise jedan oblik; poligoni se
+// uvek ucitavaju kao zatvoreni; vraca se broj
+// procitanih oblika, a greska je izuzetak
+Velicina citaj_tekst(std::istream&, const Obrada&);
+
+// Citanje tekstualne scene direktno iz bafera,
+// bez kopiranja; brojevi se citaju sa from_chars
+Velicina citaj_tekst(const char*, const char*, const Obrada&);
+
+// Ucitavanje tekstualne scene mapiranjem datoteke
+Velicina ucitaj_tekst(const std::string&, const Obrada&);
+
+// Preciznost upisa koordinata; puna je najkraci
+// zapis koji se cita kao isti broj, a dve decimale
+// odgovaraju ranijem izlazu tacka::str
+enum class Preciznost : std::uint8_t
+{
+    puna,
+    dve_decimale
+};
+
+// Upis jednog oblika u tekstualnom formatu
+void pisi_tekst(std::ostream&, const oblik&, const Preciznost = Preciznost::puna);
+
+// Cuvanje scene u tekstualnom formatu, oblik po
+// oblik; putanja je u UTF-8, a neuspeo upis je izuzetak
+void sacuvaj_tekst(const std::string&, const std::vector<const oblik*>&,
+                   const Preciznost = Preciznost::puna);
+
+// Binarni format scene (verzija 1), redom:
+//  - zaglavlje (32 bajta), sa magijom i brojevima
+//    oblika i tacaka;
+//  - tabela oblika, po 16 bajtova za svaki;
+//  - koordinate svih tacaka, x0 y0 x1 y1 ..., jedan
+//    neprekidan niz, oblik po oblik;
+// brojevi su u redosledu bajtova little-endian, a
+// svi delovi su poravnati na osam bajtova, pa se
+// datoteka moze koristiti direktno, bez kopiranja;
+// zato se format ne podrzava na big-endian procesorima
+namespace binarno {
+
+// Zaglavlje datoteke
+struct Zaglavlje
+{
+    char magija[8];
+    std::uint32_t verzija;
+    std::uint32_t rezerva;
+    std::uint64_t oblika;
+    std::uint64_t tacaka;
+};
+
+// Jedan red tabele oblika
+struct Zapis
+{
+    std::uint64_t prva;
+    std::uint32_t broj;
+    Tip tip;
+    std::uint8_t zatvoren;
+    std::uint16_t rezerva;
+};
+
+}
+
+// Binarna scena mapirana u memoriju; pri
+// otvaranju se proverava samo tabela oblika,
+// dok se koordinatama pristupa direktno
+class binarna_scena
+{
+public:
+    // Konstruktor sa putanjom do datoteke
+    explicit binarna_scena(const std::string&);
+
+    // Dohvatac za broj oblika
+    Velicina size() const;
+
+    // Dohvatac za ukupan broj tacaka
+    Velicina tacaka() const;
+
+    // Dohvataci za pojedinacan oblik
+    Tip tip(const Velicina) const;
+    bool zatvoren(const Velicina) const;
+    Velicina tacaka(const Velicina) const;
+
+    // Koordinate tacaka oblika, x0 y0 x1 y1 ...
+    const Element* koordinate(const Velicina) const;
+
+    // Kopije tacaka i oblika
+    NizTacaka tacke(const Velicina) const;
+    std::unique_ptr<oblik> kopija(const Velicina) const;
+
+private:
+    // Mapirana datoteka
+    mapa _mapa;
+
+    // Delovi datoteke
+    const binarno::Zaglavlje* _zaglavlje;
+    const binarno::Zapis* _zapisi;
+    const Element* _koordinate;
+};
+
+// Cuvanje scene u binarnom formatu; cela
+// datoteka se pravi u memoriji i upisuje odjednom;
+// putanje su, kao i pri ucitavanju, u UTF-8
+void sacuvaj_binarno(const std::string&, const std::vector<const oblik*>&);
+
+// Ucitavanje cele binarne scene
+Scena ucitaj_binarno(const std::string&);
+
+}
+
+#endif // SCENA_HPP
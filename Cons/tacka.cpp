@@ -1,6 +1,7 @@
 #include <sstream>
 #include <iterator>
 #include <iomanip>
+#include <limits>
 
 #include "tacka.hpp"
 
@@ -9,64 +10,91 @@
 // predstavljanje tacke i povezano
 namespace geom {
 
+// Homogena koordinata svake tacke; ne
+// cuva se u objektu, vec samo ovde jednom
+static const Element homogena = 1;
+
 // Konstruktor bez argumenata
 tacka::tacka()
-    : _mat({0, 0, 1})
 {}
 
-// Konstruktor od dve vrednosti
+// Konstruktor kopije sa semantikom pomeranja;
+// nema sta da se preuzme, pa se kopira, ali se
+// izvor prazni, kao sto bi bio i prazan vektor
+tacka::tacka(tacka&& t) noexcept
+    : _mat(t._mat)
+{
+    t.isprazni();
+}
+
+// Konstruktor od dve vrednosti; nema
+// provere jer je tacka vec homogena
 tacka::tacka(const Element x, const Element y)
-    : _mat({x, y, 1})
+    : _mat({x, y})
 {}
 
 // Konstruktor od tri vrednosti
 tacka::tacka(const Element x, const Element y, const Element z)
-    : _mat({x, y, z})
 {
     // Provera korektnosti tacke
-    proveri();
+    proveri(x, y, z);
 }
 
 // Konstruktor od matrice kao l-vrednost
 tacka::tacka(const Matrica& v)
-    : _mat(v[0])
 {
     // Provera korektnosti matrice
     proverim(v);
 
     // Provera korektnosti tacke
-    proveri();
+    proveri(v[0]);
 }
 
-// Konstruktor od matrice kao r-vrednost
+// Konstruktor od matrice kao r-vrednost;
+// prvi red matrice se svakako prazni
 tacka::tacka(Matrica&& v)
-    : _mat(std::move(v[0]))
 {
+    // Preuzimanje vektora tacke
+    const auto vek = std::move(v[0]);
+
     // Provera korektnosti matrice
     proverim(v);
 
     // Provera korektnosti tacke
-    proveri();
+    proveri(vek);
 }
 
 // Konstruktor od vektora kao l-vrednost
 tacka::tacka(const Vektor& v)
-    : _mat(v)
 {
     // Provera korektnosti tacke
-    proveri();
+    proveri(v);
 }
 
-// Konstruktor od vektora kao r-vrednost
+// Konstruktor od vektora kao r-vrednost;
+// prosledjeni vektor se svakako prazni
 tacka::tacka(Vektor&& v)
-    : _mat(std::move(v))
 {
+    // Preuzimanje vektora tacke
+    const auto vek = std::move(v);
+
     // Provera korektnosti tacke
-    proveri();
+    proveri(vek);
 }
 
-// Dohvatac (getter) za matricu
-const Vektor& tacka::mat() const
+// Dohvatac (getter) za vektor; prazan
+// vektor u slucaju prazne tacke
+Vektor tacka::mat() const
+{
+    if (prazna()){
+        return {};
+    }
+
+    return {_mat[0], _mat[1], homogena};
+}
+
+// Dohvatac (getter) za koordinate
+const Koordinate& tacka::koord() const
 {
     return _mat;
 }
@@ -83,25 +111,25 @@ Element tacka::tol() const
     return _tol;
 }
 
-// Kolekcijski metod za pocetak matrice
+// Kolekcijski metod za pocetak koordinata
 auto tacka::begin() const noexcept
 {
     return std::begin(_mat);
 }
 
-// Kolekcijski metod za const pocetak matrice
+// Kolekcijski metod za const pocetak koordinata
 auto tacka::cbegin() const noexcept
 {
     return std::cbegin(_mat);
 }
 
-// Kolekcijski metod za kraj matrice
+// Kolekcijski metod za kraj koordinata
 auto tacka::end() const noexcept
 {
     return std::end(_mat);
 }
 
-// Kolekcijski metod za const kraj matrice
+// Kolekcijski metod za const kraj koordinata
 auto tacka::cend() const noexcept
 {
     return std::cend(_mat);
@@ -115,7 +143,7 @@ std::string tacka::str() const
     // Prazna tacka; moguce samo u slucaju
     // pomerenog (move) ili neispravnog, lose
     // inicijalizovanog ili izmenjenog objekta
-    if (_mat.empty()){
+    if (prazna()){
         return "[]";
     }
 
@@ -133,12 +161,12 @@ std::string tacka::str() const
 
     // Kopiranje prvih vrednosti na izlazni tok
     std::copy(std::cbegin(_mat),
-              std::cend(_mat)-1,
+              std::cend(_mat),
               // Iterator izlaznog toka sa separatorom
               std::ostream_iterator<Element>(niska, ", "));
 
     // Kopiranje krajnje vrednosti na izlazni tok
-    niska << _mat[_size-1];
+    niska << homogena;
 
     // Zatvaranje glavnih zagrada
     niska << "]";
@@ -147,10 +175,16 @@ std::string tacka::str() const
     return niska.str();
 }
 
-// Primena transformacije na tacku
+// Primena transformacije na tacku; racuna se
+// u mestu, bez pravljenja privremene tacke
 void tacka::primeni(const geom& g)
 {
-    *this = g * *this;
+    const auto& [a, b, c,
+                 d, e, f] = g.koef();
+    const auto [x, y] = _mat;
+
+    _mat = {a*x + b*y + c,
+            d*x + e*y + f};
 }
 
 // Unarna potvrda
@@ -162,13 +196,8 @@ tacka tacka::operator+() const
 // Operator sabiranja
 tacka tacka::operator+(const tacka& dr) const
 {
-    tacka t;
-
-    for (Velicina i = 0; i < _size-1; i++){
-        t._mat[i] = _mat[i] + dr._mat[i];
-    }
-
-    return t;
+    return {_mat[0] + dr._mat[0],
+            _mat[1] + dr._mat[1]};
 }
 
 // Sabiranje sa numerickom vrednoscu
@@ -180,9 +209,8 @@ tacka tacka::operator+(const double broj) const
 // Operator sabiranja sa dodelom
 tacka& tacka::operator+=(const tacka& dr)
 {
-    for (Velicina i = 0; i < _size-1; i++){
-        _mat[i] += dr._mat[i];
-    }
+    _mat[0] += dr._mat[0];
+    _mat[1] += dr._mat[1];
 
     return *this;
 }
@@ -190,9 +218,8 @@ tacka& tacka::operator+=(const tacka& dr)
 // Sabiranje sa numerickom vrednoscu sa dodelom
 tacka& tacka::operator+=(const double broj)
 {
-    for (Velicina i = 0; i < _size-1; i++){
-        _mat[i] += broj;
-    }
+    _mat[0] += broj;
+    _mat[1] += broj;
 
     return *this;
 }
@@ -200,25 +227,14 @@ tacka& tacka::operator+=(const double broj)
 // Unarna negacija
 tacka tacka::operator-() const
 {
-    tacka t;
-
-    for (Velicina i = 0; i < _size-1; i++){
-        t._mat[i] = -_mat[i];
-    }
-
-    return t;
+    return {-_mat[0], -_mat[1]};
 }
 
 // Operator oduzimanja
 tacka tacka::operator-(const tacka& dr) const
 {
-    tacka t;
-
-    for (Velicina i = 0; i < _size-1; i++){
-        t._mat[i] = _mat[i] - dr._mat[i];
-    }
-
-    return t;
+    return {_mat[0] - dr._mat[0],
+            _mat[1] - dr._mat[1]};
 }
 
 // Oduzimanje numericke vrednosti
@@ -230,9 +246,8 @@ tacka tacka::operator-(const double broj) const
 // Operator oduzimanja sa dodelom
 tacka& tacka::operator-=(const tacka& dr)
 {
-    for (Velicina i = 0; i < _size-1; i++){
-        _mat[i] -= dr._mat[i];
-    }
+    _mat[0] -= dr._mat[0];
+    _mat[1] -= dr._mat[1];
 
     return *this;
 }
@@ -240,9 +255,8 @@ tacka& tacka::operator-=(const tacka& dr)
 // Oduzimanje numericke vrednosti sa dodelom
 tacka& tacka::operator-=(const double broj)
 {
-    for (Velicina i = 0; i < _size-1; i++){
-        _mat[i] -= broj;
-    }
+    _mat[0] -= broj;
+    _mat[1] -= broj;
 
     return *this;
 }
@@ -256,9 +270,8 @@ tacka tacka::operator*(const double broj) const
 // Mnozenje numerickom vrednoscu sa dodelom
 tacka& tacka::operator*=(const double broj)
 {
-    for (Velicina i = 0; i < _size-1; i++){
-        _mat[i] *= broj;
-    }
+    _mat[0] *= broj;
+    _mat[1] *= broj;
 
     return *this;
 }
@@ -266,15 +279,15 @@ tacka& tacka::operator*=(const double broj)
 // Deljenje numerickom vrednoscu
 tacka tacka::operator/(const double broj) const
 {
-    return 1/broj * *this;
+    return {_mat[0] / broj,
+            _mat[1] / broj};
 }
 
 // Deljenje numerickom vrednoscu sa dodelom
 tacka& tacka::operator/=(const double broj)
 {
-    for (Velicina i = 0; i < _size-1; i++){
-        _mat[i] /= broj;
-    }
+    _mat[0] /= broj;
+    _mat[1] /= broj;
 
     return *this;
 }
@@ -286,6 +299,11 @@ bool tacka::operator==(const tacka& dr) const
     // na sitnu gresku u racunu
     //return _mat == dr._mat;
 
+    // Prazne su jednake samo medjusobno
+    if (prazna() || dr.prazna()){
+        return prazna() && dr.prazna();
+    }
+
     return util::jednakost(_mat, dr._mat, _tol);
 }
 
@@ -312,16 +330,24 @@ bool tacka::operator<(const tacka& dr) const
     return i != _size-1 && _mat[i] < dr._mat[i];
 }
 
+// Operator dodele sa semantikom pomeranja
+tacka& tacka::operator=(tacka&& t) noexcept
+{
+    _mat = t._mat;
+
+    t.isprazni();
+
+    return *this;
+}
+
 // Operator dodele l-matrice
 tacka& tacka::operator=(const Matrica& v)
 {
-    _mat = v[0];
-
     // Provera korektnosti matrice
     proverim(v);
 
     // Provera korektnosti tacke
-    proveri();
+    proveri(v[0]);
 
     return *this;
 }
@@ -329,13 +355,14 @@ tacka& tacka::operator=(const Matrica& v)
 // Operator dodele d-matrice
 tacka& tacka::operator=(Matrica&& v)
 {
-    _mat = std::move(v[0]);
+    // Preuzimanje vektora tacke
+    const auto vek = std::move(v[0]);
 
     // Provera korektnosti matrice
     proverim(v);
 
     // Provera korektnosti tacke
-    proveri();
+    proveri(vek);
 
     return *this;
 }
@@ -343,10 +370,8 @@ tacka& tacka::operator=(Matrica&& v)
 // Operator dodele l-vektora
 tacka& tacka::operator=(const Vektor& v)
 {
-    _mat = v;
-
     // Provera korektnosti tacke
-    proveri();
+    proveri(v);
 
     return *this;
 }
@@ -354,22 +379,26 @@ tacka& tacka::operator=(const Vektor& v)
 // Operator dodele d-vektora
 tacka& tacka::operator=(Vektor&& v)
 {
-    _mat = std::move(v);
+    // Preuzimanje vektora tacke
+    const auto vek = std::move(v);
 
     // Provera korektnosti tacke
-    proveri();
+    proveri(vek);
 
     return *this;
 }
 
 // Operator indeksiranja za dohvatanje;
 // vraca referencu da ne bi bilo kopiranja;
-// briga o validnosti indeksa prepusta se
-// vektoru, koji se nalazi ispod omotaca;
-// menjanje nije dozovoljeno (const)
+// homogena koordinata je zajednicka za sve
+// tacke; menjanje nije dozovoljeno (const)
 const Element& tacka::operator[](const Velicina i) const
 {
-    return _mat.at(i);
+    if (i >= _size){
+        throw std::out_of_range("Indeks van granica!");
+    }
+
+    return i == _size-1 ? homogena : _mat[i];
 }
 
 // Struktura koja sluzi za citanje
@@ -383,16 +412,16 @@ tacka::Citac tacka::Citac::operator,(const Element x) const
 {
     // Provera indeksa
     if (i >= t._size){
-        t._mat.clear();
+        t.isprazni();
         throw Exc("Visak argumenata!");
     }
 
-    // Upis broja
-    t._mat[i] = x;
-
-    // Provera po zavrsetku
+    // Upis broja ili, po zavrsetku,
+    // provera i homogenizacija tacke
     if (i == t._size-1){
-        t.proveri();
+        t.proveri(t._mat[0], t._mat[1], x);
+    } else {
+        t._mat[i] = x;
     }
 
     // Nastavljanje dalje
@@ -410,36 +439,38 @@ tacka::Citac tacka::operator<<(const Element x)
 }
 
 // Provera korektnosti tacke
-void tacka::proveri()
+void tacka::proveri(const Element x, const Element y, const Element z)
+{
+    // Greska u slucaju beskonacne tacke
+    if (util::jednakost(z, 0.0, _tol)){
+        isprazni();
+        throw Exc("Nisu podrzane beskonacne tacke!");
+    }
+
+    // Popravka nehomogenizovanih tacaka
+    // deljenjem svake poslednjom koordinatom
+    _mat = {x/z, y/z};
+}
+
+// Provera korektnosti vektora
+void tacka::proveri(const Vektor& v)
 {
     // Dodavanje homogenog dela ako fali
-    // na kopiran vec ucitani (pod)vektor
-    if (std::size(_mat) == _size-1){
-        _mat.push_back(1);
+    if (std::size(v) == _size-1){
+        _mat = {v[0], v[1]};
+        return;
     }
 
     // Izbacivanje izuzetka u slucaju
     // nekorektne velicine vektora
-    if (std::size(_mat) != _size){
-        _mat.clear();
+    if (std::size(v) != _size){
+        isprazni();
         throw Exc("Vektor nije duzine " +
                   std::to_string(_size) + "!");
     }
 
-    // Greska u slucaju beskonacne tacke
-    if (util::jednakost(_mat[_size-1], 0.0, _tol)){
-        _mat.clear();
-        throw Exc("Nisu podrzane beskonacne tacke!");
-    }
-
-    // Popravka nehomogenizovanih tacaka
-    // deljenjem svake poslednjom koordinatom
-    std::transform(std::cbegin(_mat),
-                   std::cend(_mat),
-                   std::begin(_mat),
-                   std::bind(std::divides<>(),
-                             std::placeholders::_1,
-                             _mat[_size-1]));
+    // Provera korektnosti tacke
+    proveri(v[0], v[1], v[2]);
 }
 
 // Provera korektnosti matrice
@@ -447,11 +478,25 @@ void tacka::proverim(const Matrica& v)
 {
     // Mora biti oblika 1x3
     if (std::size(v) != 1){
-        _mat.clear();
+        isprazni();
         throw Exc("Matrica nije ranga 1!");
     }
 }
 
+// Praznjenje tacke; obelezava se
+// vrednoscu koja nije broj (NaN), posto
+// takva koordinata nema nikakvog smisla
+void tacka::isprazni()
+{
+    _mat[0] = std::numeric_limits<Element>::quiet_NaN();
+}
+
+// Provera praznine tacke
+bool tacka::prazna() const
+{
+    return std::isnan(_mat[0]);
+}
+
 // Operator ispisa na izlazni tok
 std::ostream& operator<<(std::ostream& out, const tacka& t)
 {
@@ -461,19 +506,25 @@ std::ostream& operator<<(std::ostream& out, const tacka& t)
 // Operator citanja sa ulaznog toka
 std::istream& operator>>(std::istream& in, tacka& t)
 {
-    // Kopiranje vrednosti sa ulaza
-    std::copy_n(std::istream_iterator<Element>(in),
-                t._size-1,
-                std::begin(t._mat));
+    // Ucitavanje prvih vrednosti sa ulaza
+    Element x, y, z = homogena;
+    in >> x >> y;
 
-    // Uzimanje poslednje ako postoji
-    if (!in.eof()) {
-        in >> t._mat[t._size-1];
+    // Uzimanje poslednje ako postoji; ako
+    // je ulaz samo iscrpljen, nije greska
+    if (in && !in.eof() && !(in >> z) && in.eof()){
+        in.clear(std::ios::eofbit);
+    }
+
+    // Neuspesno citanje sa ulaza
+    if (!in){
+        t.isprazni();
+        return in;
     }
 
     // Provera korektnosti ulaza
     try{
-        t.proveri();
+        t.proveri(x, y, z);
     } catch (Exc&){
         in.setstate(std::ios::failbit);
     }
@@ -485,54 +536,42 @@ std::istream& operator>>(std::istream& in, tacka& t)
 // Operator za mnozenje matrice i tacke
 tacka operator*(const geom& g, const tacka& t)
 {
-    // Velicina izlazne tacke
-    const auto vel = std::size(t);
+    // Kopija tacke kao inicijalni rezultat
+    auto rez = t;
 
-    // Nula-vektor kao inicijalni rezultat
-    auto rez = Vektor(vel, 0);
-
-    // Klasicno mnozenje u dvostrukoj petlji
-    for (Velicina i = 0; i < vel; i++){
-        for (Velicina j = 0; j < vel; j++){
-            rez[i] += g[i][j] * t[j];
-        }
-    }
+    // Primena transformacije u mestu
+    rez.primeni(g);
 
-    // Vracanje rezultata; eksplicitno pomeranje
-    // kako bi se isforsirala optimizacija (RVO)
-    return std::move(rez);
+    // Vracanje rezultata
+    return rez;
 }
 
 // Operator za sabiranje sa numerickom vrednoscu
 tacka operator+(const double broj, const tacka& t)
 {
-    return util::primeni(broj,
-                         t,
-                         std::plus<>());
+    return {broj + t[0],
+            broj + t[1]};
 }
 
 // Operator za oduzimanje numericke vrednosti
 tacka operator-(const double broj, const tacka& t)
 {
-    return util::primeni(broj,
-                         -t,
-                         std::plus<>());
+    return {broj - t[0],
+            broj - t[1]};
 }
 
 // Operator za mnozenje numerickom vrednoscu
 tacka operator*(const double broj, const tacka& t)
 {
-    return util::primeni(broj,
-                         t,
-                         std::multiplies<>());
+    return {broj * t[0],
+            broj * t[1]};
 }
 
 // Operator za deljenje numerickom vrednoscu
 tacka operator/(const double broj, const tacka& t)
 {
-    return util::primeni(broj,
-                         tacka(1/t[0], 1/t[1], 1),
-                         std::multiplies<>());
+    return {broj / t[0],
+            broj / t[1]};
 }
 
 }
@@ -23,10 +23,12 @@ public:
     tacka(const tacka&) = default;
 
     // Konstruktor kopije sa semantikom pomeranja;
-    // uzima se podrazumevani sablon pomeranja (move)
-    tacka(tacka&&) noexcept = default;
+    // kopira koordinate, a izvor ostaje prazan
+    tacka(tacka&&) noexcept;
 
-    // Konstruktori od brojeva
+    // Konstruktori od brojeva; par se ne proverava,
+    // kao ni rezultati aritmetike nad tackama, dok
+    // se homogena trojka, vektor, tok i citac proveravaju
     tacka(const Element, const Element);
     tacka(const Element, const Element, const Element);
 
@@ -36,8 +38,12 @@ public:
     tacka(const Vektor&);
     tacka(Vektor&&);
 
-    // Dohvatac za vektor
-    const Vektor& mat() const;
+    // Dohvatac za vektor; pravi se novi
+    // homogeni vektor od koordinata
+    Vektor mat() const;
+
+    // Dohvatac za koordinate
+    const Koordinate& koord() const;
 
     // Dohvatac za velicinu
     Velicina size() const;
@@ -110,8 +116,8 @@ public:
     tacka& operator=(const tacka&) = default;
 
     // Operator dodele sa semantikom pomeranja;
-    // podrazumevani sablon pomeranja (move)
-    tacka& operator=(tacka&&) noexcept = default;
+    // kopira koordinate, a izvor ostaje prazan
+    tacka& operator=(tacka&&) noexcept;
 
     // Operatori dodele vektora
     tacka& operator=(const Matrica&);
@@ -145,25 +151,37 @@ public:
     Citac operator<<(const Element);
 
 private:
-    // Provera korektnosti tacke
-    void proveri();
+    // Provera korektnosti tacke i
+    // preuzimanje homogenih koordinata
+    void proveri(const Element, const Element, const Element);
+
+    // Provera korektnosti vektora
+    void proveri(const Vektor&);
 
     // Provera korektnosti matrice
     void proverim(const Matrica&);
 
+    // Praznjenje tacke; prazna je ona
+    // koja je pomerena (move) ili neispravna
+    void isprazni();
+
+    // Provera praznine tacke
+    bool prazna() const;
+
     // Tacka u ravni predstavljena je homogenim
-    // vektorom duzine tri, a podrazumevano je
-    // u pitanju koordinatni pocetak; nije const
-    // zbog mogucnosti pomeranja (move)
-    Vektor _mat;
-
-    // Vektor je fiksne velicine,
-    // ali slicno nije const
-    Velicina _size = 3;
-
-    // Tolerancija u slucaju greske u racunu;
-    // nije const iz istog razloga kao dosad
-    Element _tol = 1e-5;
+    // vektorom duzine tri, ali se cuvaju samo prve
+    // dve koordinate, bez dinamicke alokacije, dok
+    // je treca uvek 1; podrazumevano je u pitanju
+    // koordinatni pocetak; nije const zbog
+    // mogucnosti pomeranja (move)
+    Koordinate _mat{0, 0};
+
+    // Velicina homogenog vektora je fiksna, pa
+    // je zajednicka za sve tacke, kao i tolerancija
+    static constexpr Velicina _size = 3;
+
+    // Tolerancija u slucaju greske u racunu
+    static constexpr Element _tol = 1e-5;
 
     // Operator citanja sa ulaznog toka; mora
     // prijateljski kako bi pristupao vektoru
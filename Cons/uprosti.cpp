@@ -0,0 +1,340 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <tuple>
+
+#include "uprosti.hpp"
+
+// Imenski prostor za geometriju; u ovoj
+// datoteci je uproscavanje linija
+namespace geom {
+
+// Anonimni prostor za pomocne funkcije
+namespace {
+
+// Kvadrat rastojanja tacke od duzi; ako se
+// krajevi duzi poklapaju, to je rastojanje
+// od tog kraja, pa rade i zatvorene linije
+Element rastojanje2(const tacka& t, const tacka& a, const tacka& b)
+{
+    const auto& p = t.koord();
+    const auto& k = a.koord();
+    const auto& l = b.koord();
+
+    const auto dx = l[0] - k[0];
+    const auto dy = l[1] - k[1];
+    const auto d2 = dx*dx + dy*dy;
+
+    auto px = p[0] - k[0];
+    auto py = p[1] - k[1];
+    if (d2 > 0){
+        const auto s = std::clamp((px*dx + py*dy) / d2, Element{0}, Element{1});
+        px -= s*dx;
+        py -= s*dy;
+    }
+
+    return px*px + py*py;
+}
+
+// Povrsina trougla temena sa susedima
+Element povrsina(const tacka& a, const tacka& b, const tacka& c)
+{
+    const auto& p = a.koord();
+    const auto& q = b.koord();
+    const auto& r = c.koord();
+
+    return std::abs((q[0] - p[0]) * (r[1] - p[1]) -
+                    (r[0] - p[0]) * (q[1] - p[1])) / 2;
+}
+
+// Najdalje teme strogo izmedju krajeva
+// i kvadrat njegovog rastojanja; pri
+// jednakim rastojanjima bira se prvo
+std::pair<Velicina, Element> najdalje(const NizTacaka& t,
+                                      const Velicina i, const Velicina j)
+{
+    auto rez = i;
+    auto najvise = Element{-1};
+    for (auto k = i + 1; k < j; k++){
+        const auto d = rastojanje2(t[k], t[i], t[j]);
+        if (d > najvise){
+            rez = k;
+            najvise = d;
+        }
+    }
+
+    return {rez, najvise};
+}
+
+// Uproscen poligon iste zatvorenosti
+poly uprosceno(const poly& p, NizTacaka&& t)
+{
+    poly rez(std::move(t));
+    if (p.zatvoren()){
+        rez.zatvori();
+    }
+
+    return rez;
+}
+
+}
+
+// Douglas-Peucker; deo linije se deli najdaljim
+// temenom sve dok je ono dalje od tolerancije
+NizTacaka douglas_peucker(const NizTacaka& t, const Element tolerancija)
+{
+    const auto n = std::size(t);
+    if (n <= 2){
+        return t;
+    }
+
+    const auto granica = tolerancija * tolerancija;
+
+    std::vector<bool> zadrzano(n, false);
+    zadrzano.front() = zadrzano.back() = true;
+
+    std::vector<std::pair<Velicina, Velicina>> stek{{0, n - 1}};
+    while (!stek.empty()){
+        const auto [i, j] = stek.back();
+        stek.pop_back();
+
+        const auto [k, d] = najdalje(t, i, j);
+        if (k != i && d > granica){
+            zadrzano[k] = true;
+            stek.emplace_back(k, j);
+            stek.emplace_back(i, k);
+        }
+    }
+
+    NizTacaka rez;
+    for (Velicina i = 0; i < n; i++){
+        if (zadrzano[i]){
+            rez.push_back(t[i]);
+        }
+    }
+
+    return rez;
+}
+
+// Visvalingam-Whyatt; temena su povezana u listu,
+// a povrsine u hip; posle uklanjanja temena hip se
+// ne popravlja, vec se zastareli ulazi preskacu po
+// verziji temena, dok povrsina suseda ne moze pasti
+// ispod upravo uklonjene, pa je redosled monoton
+NizTacaka visvalingam(const NizTacaka& t, const Element tolerancija)
+{
+    const auto n = std::size(t);
+    if (n <= 2){
+        return t;
+    }
+
+    const auto granica = tolerancija * tolerancija;
+
+    std::vector<Velicina> pre(n), posle(n), verzija(n, 0);
+    for (Velicina i = 0; i < n; i++){
+        pre[i] = i - 1;
+        posle[i] = i + 1;
+    }
+
+    using Ulaz = std::tuple<Element, Velicina, Velicina>;
+    std::priority_queue<Ulaz, std::vector<Ulaz>, std::greater<Ulaz>> hip;
+    for (Velicina i = 1; i + 1 < n; i++){
+        hip.emplace(povrsina(t[i - 1], t[i], t[i + 1]), i, 0);
+    }
+
+    std::vector<bool> zadrzano(n, true);
+    while (!hip.empty()){
+        const auto [a, i, v] = hip.top();
+        if (!(a < granica)){
+            break;
+        }
+        hip.pop();
+
+        if (!zadrzano[i] || v != verzija[i]){
+            continue;
+        }
+
+        zadrzano[i] = false;
+        const auto l = pre[i];
+        const auto d = posle[i];
+        posle[l] = d;
+        pre[d] = l;
+
+        if (l != 0){
+            hip.emplace(std::max(a, povrsina(t[pre[l]], t[l], t[d])), l, ++verzija[l]);
+        }
+        if (d != n - 1){
+            hip.emplace(std::max(a, povrsina(t[l], t[d], t[posle[d]])), d, ++verzija[d]);
+        }
+    }
+
+    NizTacaka rez;
+    for (Velicina i = 0; i < n; i++){
+        if (zadrzano[i]){
+            rez.push_back(t[i]);
+        }
+    }
+
+    return rez;
+}
+
+// Douglas-Peucker za poligon
+poly douglas_peucker(const poly& p, const Element tolerancija)
+{
+    return uprosceno(p, douglas_peucker(p.tacke(), tolerancija));
+}
+
+// Visvalingam-Whyatt za poligon
+poly visvalingam(const poly& p, const Element tolerancija)
+{
+    return uprosceno(p, visvalingam(p.tacke(), tolerancija));
+}
+
+// Konstruktor od niza tacaka; stablo se gradi
+// kao u Douglas-Peucker bez tolerancije, a znacaj
+// temena ogranicava znacajem roditelja; rang je
+// polozaj po opadajucem znacaju, pri cemu roditelj
+// uvek prethodi detetu, jer je blizi korenu
+nivoi_detalja::nivoi_detalja(const NizTacaka& t)
+    : _tacke(t),
+      _levo(std::size(t), nema),
+      _desno(std::size(t), nema),
+      _znacaj(std::size(t), std::numeric_limits<Element>::infinity()),
+      _rang(std::size(t), 0)
+{
+    const auto n = std::size(t);
+    if (n <= 2){
+        return;
+    }
+
+    // Deo linije, cvor koji ga deli i
+    // mesto na koje se upisuje njegovo dete
+    struct Deo
+    {
+        Velicina i, j;
+        Velicina* dete;
+        Element gornja;
+        Velicina dubina;
+    };
+
+    std::vector<Velicina> dubina(n, 0);
+    std::vector<Deo> stek{{0, n - 1, &_koren,
+                           std::numeric_limits<Element>::infinity(), 0}};
+    while (!stek.empty()){
+        const auto deo = stek.back();
+        stek.pop_back();
+
+        if (deo.j - deo.i < 2){
+            continue;
+        }
+
+        const auto [k, d] = najdalje(_tacke, deo.i, deo.j);
+        *deo.dete = k;
+        _znacaj[k] = std::min(deo.gornja, std::sqrt(d));
+        dubina[k] = deo.dubina;
+
+        stek.push_back({k, deo.j, &_desno[k], _znacaj[k], deo.dubina + 1});
+        stek.push_back({deo.i, k, &_levo[k], _znacaj[k], deo.dubina + 1});
+    }
+
+    std::vector<Velicina> red(n - 2);
+    std::iota(std::begin(red), std::end(red), Velicina{1});
+    std::sort(std::begin(red), std::end(red),
+              [this, &dubina](const Velicina a, const Velicina b)
+              {
+                  return std::make_tuple(-_znacaj[a], dubina[a], a) <
+                         std::make_tuple(-_znacaj[b], dubina[b], b);
+              });
+
+    for (Velicina r = 0; r < n - 2; r++){
+        _rang[red[r]] = r;
+    }
+}
+
+// Dohvatac za broj temena
+Velicina nivoi_detalja::size() const
+{
+    return std::size(_tacke);
+}
+
+// Znacaj temena
+Element nivoi_detalja::znacaj(const Velicina i) const
+{
+    if (i >= std::size(_tacke)){
+        throw Exc("Nepostojece teme!");
+    }
+
+    return _znacaj[i];
+}
+
+// Temena za toleranciju; dete nikad nije
+// znacajnije od roditelja, pa se obilazak
+// zaustavlja na prvom nedovoljno znacajnom
+NizTacaka nivoi_detalja::po_toleranciji(const Element tolerancija) const
+{
+    return obidji([this, tolerancija](const Velicina k)
+                  {
+                      return _znacaj[k] > tolerancija;
+                  });
+}
+
+// Najvaznijih k temena; krajnje tacke se
+// uvek zadrzavaju, a ostala po rangu
+NizTacaka nivoi_detalja::po_broju(const Velicina k) const
+{
+    if (k <= 2){
+        NizTacaka rez(std::cbegin(_tacke),
+                      std::cbegin(_tacke) + std::min(k, std::size(_tacke)));
+        if (k == 2 && std::size(_tacke) > 2){
+            rez.back() = _tacke.back();
+        }
+        return rez;
+    }
+
+    return obidji([this, k](const Velicina i)
+                  {
+                      return _rang[i] < k - 2;
+                  });
+}
+
+// Obilazak po redu temena uz stek; posecuju se
+// samo zadrzani cvorovi i njihova neposredna deca
+template <typename Uslov>
+NizTacaka nivoi_detalja::obidji(Uslov uslov) const
+{
+    NizTacaka rez;
+    if (_tacke.empty()){
+        return rez;
+    }
+
+    rez.push_back(_tacke.front());
+
+    std::vector<Velicina> stek;
+    auto k = _koren;
+    while (k != nema || !stek.empty()){
+        if (k != nema && uslov(k)){
+            stek.push_back(k);
+            k = _levo[k];
+            continue;
+        }
+
+        if (stek.empty()){
+            break;
+        }
+
+        k = stek.back();
+        stek.pop_back();
+        rez.push_back(_tacke[k]);
+        k = _desno[k];
+    }
+
+    if (std::size(_tacke) > 1){
+        rez.push_back(_tacke.back());
+    }
+
+    return rez;
+}
+
+}
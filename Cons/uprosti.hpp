@@ -0,0 +1,79 @@
+#ifndef UPROSTI_HPP
+#define UPROSTI_HPP
+
+#include "oblik.hpp"
+
+// Imenski prostor za geometriju
+namespace geom {
+
+// Uproscavanje izlomljene linije postupkom
+// Douglas-Peucker; zadrzavaju se krajnje tacke
+// i sva temena koja bi odstupala od uproscene
+// linije za vise od tolerancije (u jedinicama
+// ravni); umesto rekurzije koristi se stek
+NizTacaka douglas_peucker(const NizTacaka&, const Element);
+
+// Uproscavanje izlomljene linije postupkom
+// Visvalingam-Whyatt; temena se redom uklanjaju
+// po najmanjoj efektivnoj povrsini trougla koji
+// grade sa susedima, dok god je ona manja od
+// kvadrata tolerancije; krajnje tacke ostaju
+NizTacaka visvalingam(const NizTacaka&, const Element);
+
+// Uproscavanje poligona; zatvorenost se cuva,
+// a kod zatvorenih su prvo i poslednje teme
+// krajevi linije, pa se uvek zadrzavaju
+poly douglas_peucker(const poly&, const Element);
+poly visvalingam(const poly&, const Element);
+
+// Visestruka rezolucija po Douglas-Peucker; stablo
+// podela se racuna jednom, a znacaj temena je najvise
+// znacaj njegovog roditelja, pa su temena zadrzana za
+// bilo koju toleranciju ili broj zatvoren skup odozgo;
+// zato se svaki nivo detalja izdvaja obilaskom samo
+// zadrzanih cvorova, za vreme O(k) za k temena
+class nivoi_detalja
+{
+public:
+    // Konstruktor od niza tacaka
+    explicit nivoi_detalja(const NizTacaka&);
+
+    // Dohvatac za broj temena
+    Velicina size() const;
+
+    // Znacaj temena; krajnje tacke su beskonacne
+    Element znacaj(const Velicina) const;
+
+    // Temena koja bi zadrzao Douglas-Peucker
+    // sa datom tolerancijom, redom
+    NizTacaka po_toleranciji(const Element) const;
+
+    // Najvaznijih k temena, redom
+    NizTacaka po_broju(const Velicina) const;
+
+private:
+    // Oznaka nepostojeceg cvora
+    static constexpr Velicina nema = static_cast<Velicina>(-1);
+
+    // Obilazak stabla po redu temena; u
+    // podstablo se ulazi samo ako uslov vazi
+    template <typename Uslov>
+    NizTacaka obidji(Uslov) const;
+
+    // Sva temena linije
+    NizTacaka _tacke;
+
+    // Stablo podela; koren je teme koje deli
+    // celu liniju, a deca dele njene polovine
+    Velicina _koren = nema;
+    std::vector<Velicina> _levo;
+    std::vector<Velicina> _desno;
+
+    // Znacaj i rang svakog temena
+    std::vector<Element> _znacaj;
+    std::vector<Velicina> _rang;
+};
+
+}
+
+#endif // UPROSTI_HPP
@@ -2,8 +2,11 @@
 #define UTIL_HPP
 
 #include <numeric>
+#include <algorithm>
 #include <functional>
 #include <cmath>
+#include <array>
+#include <iterator>
 
 // Imenski prostor pomocnih funkcija; namenjem je
 // za implementaciju mahom sablonskih funkcija
@@ -219,6 +222,70 @@ MatNeConst pow(Matrica&& baza, const int exp)
     return exp >= 0 ? rez : rez.inv();
 }
 
+// Sablonska fja za mnozenje afinih matrica,
+// zadatih samo sa prva dva reda (a b c; d e f),
+// dok se poslednji red {0, 0, 1} podrazumeva;
+// kako je i proizvod afin, njegov poslednji red
+// se ne racuna, pa je dovoljno 12 mnozenja
+// umesto 27; rezultat se upisuje u treci
+// argument, koji sme biti isti kao i neki od
+// cinilaca, pa nema nikakve alokacije
+template <typename Element>
+void mult_afin(const std::array<Element, 6>& a,
+               const std::array<Element, 6>& b,
+               std::array<Element, 6>& rez)
+{
+    // Prvi red proizvoda; doprinos poslednjeg
+    // reda druge matrice je samo u slobodnom
+    // clanu, jer je on {0, 0, 1}
+    const auto r0 = a[0]*b[0] + a[1]*b[3];
+    const auto r1 = a[0]*b[1] + a[1]*b[4];
+    const auto r2 = a[0]*b[2] + a[1]*b[5] + a[2];
+
+    // Drugi red proizvoda
+    const auto r3 = a[3]*b[0] + a[4]*b[3];
+    const auto r4 = a[3]*b[1] + a[4]*b[4];
+    const auto r5 = a[3]*b[2] + a[4]*b[5] + a[5];
+
+    // Upis tek na kraju, zbog preklapanja
+    rez = {r0, r1, r2,
+           r3, r4, r5};
+}
+
+// Sablonska fja za stepenovanje afine matrice
+// u mestu; isti logaritamski algoritam kao
+// iznad, ali bez ikakve alokacije; negativni
+// stepen nije podrzan, jer inverz zavisi od
+// tipa preslikavanja, pa o njemu brine pozivalac
+template <typename Element>
+void pow_afin(std::array<Element, 6>& baza, unsigned exp)
+{
+    // Jedinicna transformacija
+    std::array<Element, 6> rez{1, 0, 0,
+                               0, 1, 0};
+
+    // Dok se ne iscrpi stepen
+    while (exp > 0){
+        // Ako je neparan, mnozi se
+        // rez argumentom stepenovanja
+        if (exp & 1){
+            mult_afin(rez, baza, rez);
+        }
+
+        // Deljenje stepena sa dva
+        exp >>= 1;
+
+        // Kvadriranje argumenta, osim
+        // ako vise nije potreban
+        if (exp > 0){
+            mult_afin(baza, baza, baza);
+        }
+    }
+
+    // Upis rezultata u bazu
+    baza = rez;
+}
+
 // Sablonska fja za primenu binarne operacije
 // nad ovde bitnim objektima poput tacaka
 template <typename Levo,
@@ -311,104 +378,142 @@ const auto podela = [](const auto& u, const auto& v, const auto& tacke)
                       {return listcomp(tacke, [&u, &v](const auto& t)
                                                       {return vekt_proiz(t, u, v) < 0;});};
 
-// Lambda dohvatac indeksa
-const auto itemgetter = [](const auto& i)
-                          {return [&i](const auto niz){return niz[i];};};
-const auto get0 = itemgetter(0);
-const auto get0comp = [](const auto& a, const auto& b)
-                        {return get0(a) < get0(b);};
-
-// Prosirivanje pretrage omotnih tacaka
-template <typename Niz,
-          typename NizNeConst = typename std::decay<Niz>::type,
-          typename Tacka = typename NizNeConst::value_type>
-NizNeConst prosiri(Tacka& u, Tacka& v, Niz&& tacke)
+// Sablonska fja za pronalazak konveksnog omotaca
+// u mestu, Endruovim monotonim lancem (Andrew's
+// monotone chain); tacke se uredjuju leksikografski,
+// a zatim se donji i gornji lanac grade kao stek na
+// pocetku samog niza, zamenom elemenata, pa nema ni
+// rekurzije ni ikakve dodatne alokacije; nakon poziva
+// omot je u [prvi, rez), pocinje najdesnijom tackom i
+// ide suprotno kazaljci na satu kroz najleviju, dok
+// su ostale tacke permutovane u [rez, poslednji);
+// kolinearne i ponovljene tacke nisu deo omota
+template <typename Iter>
+Iter konv_omot(const Iter prvi, const Iter poslednji)
 {
-    // Nema prosirivanja praznog niza
-    if (std::forward<Niz>(tacke).empty()){
-        return {};
+    // Jedna ili nijedna tacka je sama svoj omot
+    if (poslednji - prvi < 2){
+        return poslednji;
     }
 
-    // Nalazenje najudaljenije tacke
-    const auto vpk = [&u, &v](const auto& t)
-                             {return vekt_proiz(t, u, v);};
-    const auto key = [&vpk](const auto& a, const auto& b)
-                           {return vpk(a) < vpk(b);};
-
-    const auto w = *std::min_element(std::cbegin(std::forward<Niz>(tacke)),
-                                     std::cend(std::forward<Niz>(tacke)),
-                                     key);
-
-    // Podela pretrage po odredjenoj tacki
-    const auto t1 = podela(w, v, std::forward<Niz>(tacke));
-    const auto t2 = podela(u, w, std::forward<Niz>(tacke));
-
-    // Prosirivanje pretrage
-    const auto p1 = prosiri(w, v, t1);
-    const auto p2 = prosiri(u, w, t2);
-
-    // Formiranje rezultata
-    NizNeConst rez;
-    rez.insert(std::end(rez),
-               std::cbegin(p1),
-               std::cend(p1));
-    rez.push_back(w);
-    rez.insert(std::end(rez),
-               std::cbegin(p2),
-               std::cend(p2));
+    // Leksikografsko poredjenje tacaka
+    const auto manja = [](const auto& a, const auto& b)
+                         {return a[0] < b[0] ||
+                                 (a[0] == b[0] && a[1] < b[1]);};
+
+    // Tacke koje se ne razlikuju
+    const auto ista = [](const auto& a, const auto& b)
+                        {return a[0] == b[0] && a[1] == b[1];};
+
+    // Pravljenje lanca od tacaka iz [pocetak, kraj) na steku
+    // koji pocinje u dnu, a trenutno se zavrsava u vrh;
+    // tacka ostaje na steku samo ako skrece ulevo
+    const auto lanac = [&ista](const Iter dno, Iter vrh,
+                               const Iter pocetak, const Iter kraj)
+                         {
+                             for (auto it = pocetak; it != kraj; ++it){
+                                 // Preskakanje ponovljene tacke
+                                 if (ista(*(vrh-1), *it)){
+                                     continue;
+                                 }
+
+                                 // Skidanje sa steka tacaka koje
+                                 // ne skrecu ulevo ka novoj tacki
+                                 while (vrh - dno >= 2 &&
+                                        !(vekt_proiz(*it, *(vrh-2), *(vrh-1)) < 0)){
+                                     --vrh;
+                                 }
+
+                                 // Stavljanje nove tacke na stek
+                                 std::iter_swap(vrh++, it);
+                             }
+
+                             return vrh;
+                         };
+
+    // Ekstremne tacke po obe ose, u poretku suprotnom
+    // kazaljci na satu: najleva, najniza, najdesnija
+    // i najvisa; one su sigurno deo omota
+    const auto x = [](const auto& a, const auto& b){return a[0] < b[0];};
+    const auto y = [](const auto& a, const auto& b){return a[1] < b[1];};
+    const auto [levo, desno] = std::minmax_element(prvi, poslednji, x);
+    const auto [dole, gore] = std::minmax_element(prvi, poslednji, y);
+
+    // Ivice cetvorougla ekstremnih tacaka, kao
+    // pocetak i pravac, kako bi se izbeglo stalno
+    // indeksiranje tacaka u najvrucoj petlji
+    using Element = typename std::decay<decltype((*prvi)[0])>::type;
+    std::array<std::array<Element, 4>, 4> ivice;
+    const Iter ekstremi[] = {levo, dole, desno, gore};
+    for (auto i = 0; i < 4; i++){
+        const auto& u = *ekstremi[i];
+        const auto& v = *ekstremi[(i+1)%4];
+        ivice[i] = {u[0], u[1], v[0]-u[0], v[1]-u[1]};
+    }
 
-    // Vracanje rezultata; eksplicitno pomeranje
-    // kako bi se isforsirala optimizacija (RVO)
-    return std::move(rez);
+    // Odbacivanje tacaka strogo unutar cetvorougla
+    // ekstremnih (Akl-Toussaint heuristika); njih
+    // je obicno daleko najvise, a posle se vise ne
+    // uredjuju; tacke na ivicama ostaju, pa je
+    // odbacivanje ispravno i za degenerisan cetvorougao;
+    // racun je isti kao u vekt_proiz
+    const auto kraj = std::partition(prvi, poslednji,
+                                     [&ivice](const auto& t)
+                                     {
+                                         const Element tx = t[0];
+                                         const Element ty = t[1];
+                                         for (const auto& [ux, uy, dx, dy] : ivice){
+                                             if (!((tx-ux)*dy - (ty-uy)*dx < 0)){
+                                                 return true;
+                                             }
+                                         }
+                                         return false;
+                                     });
+
+    // Donji lanac, od najleve do najdesnije tacke
+    std::sort(prvi, kraj, manja);
+    auto vrh = lanac(prvi, prvi+1, prvi+1, kraj);
+
+    // Najdesnija tacka je na vrhu donjeg lanca
+    const auto desna = vrh-1;
+
+    // Gornji lanac, od najdesnije nazad do najleve
+    // tacke, od preostalih tacaka u obrnutom poretku
+    std::sort(vrh, kraj, [&manja](const auto& a, const auto& b)
+                                 {return manja(b, a);});
+    vrh = lanac(desna, vrh, vrh, kraj);
+
+    // Zatvaranje gornjeg lanca najlevom tackom,
+    // koja je vec na dnu donjeg lanca
+    while (vrh - desna >= 2 &&
+           !(vekt_proiz(*prvi, *(vrh-2), *(vrh-1)) < 0)){
+        --vrh;
+    }
+
+    // Rotacija tako da omot pocne najdesnijom
+    // tackom, a zatim nastavi gornjim lancem
+    std::rotate(prvi, desna, vrh);
+
+    // Vracanje kraja omota
+    return vrh;
 }
 
-// Sablonska fja za pronalazak konveksnog omotaca;
-// jednostavnosti radi ogranicena na vektor tacaka
+// Sablonska fja za pronalazak konveksnog omotaca
+// kolekcije tacaka; kopija (ili pomereni izvor)
+// se obradjuje u mestu i skracuje na sam omot
 template <typename Niz,
-          typename NizNeConst = typename std::decay<Niz>::type,
-          typename Tacka = typename NizNeConst::value_type>
+          typename NizNeConst = typename std::decay<Niz>::type>
 NizNeConst konv_omot(Niz&& tacke)
 {
-    // Prazan niz tacaka nema konveksni omot
-    if (std::forward<Niz>(tacke).empty()){
-        return {};
-    }
+    // Inicijalizacija rezultata
+    NizNeConst rez = std::forward<Niz>(tacke);
 
-    // Nalazenje dve tacke omota
-    const auto u = *std::min_element(std::cbegin(std::forward<Niz>(tacke)),
-                                     std::cend(std::forward<Niz>(tacke)),
-                                     get0comp);
-    const auto v = *std::max_element(std::cbegin(std::forward<Niz>(tacke)),
-                                     std::cend(std::forward<Niz>(tacke)),
-                                     get0comp);
-
-    // Podela pretrage na levu i desnu stranu
-    const auto levo = podela(u, v, std::forward<Niz>(tacke));
-    const auto desno = podela(v, u, std::forward<Niz>(tacke));
-
-    // Nalazenje omota na obe strane
-    const auto plevo = prosiri(u, v, levo);
-    const auto pdesno = prosiri(v, u, desno);
-
-    // Formiranje rezultata
-    NizNeConst rez;
-    rez.push_back(v);
-    rez.insert(std::end(rez),
-               std::cbegin(plevo),
-               std::cend(plevo));
-    rez.push_back(u);
-    rez.insert(std::end(rez),
-               std::cbegin(pdesno),
-               std::cend(pdesno));
-
-    // Popravka u slucaju dve tacke
-    if (rez.size() == 2 && rez[0] == rez[1]){
-        rez.pop_back();
-    }
+    // Odbacivanje tacaka van omota
+    rez.erase(konv_omot(std::begin(rez), std::end(rez)),
+              std::end(rez));
 
-    // Vracanje rezultata; eksplicitno pomeranje
-    // kako bi se isforsirala optimizacija (RVO)
-    return std::move(rez);
+    // Vracanje rezultata
+    return rez;
 }
 
 // Funkcija za pretvaranje stepena u radijane
@@ -2,5 +2,6 @@ TEMPLATE = subdirs
 
 SUBDIRS += \
     App \
+    Bench \
     Cons \
     Test
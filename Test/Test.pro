@@ -6,20 +6,44 @@ CONFIG -= qt
 SOURCES += \
     afin_test.cpp \
     geom_test.cpp \
+    indeks_test.cpp \
+    jezgro_test.cpp \
+    lanac_test.cpp \
+    mreza_test.cpp \
     main.cpp \
     oblik_test.cpp \
+    paralelno_test.cpp \
+    scena_test.cpp \
     tacka_test.cpp \
+    uprosti_test.cpp \
     util_test.cpp \
     "../Cons/afin.cpp" \
     "../Cons/geom.cpp" \
+    "../Cons/indeks.cpp" \
+    "../Cons/jezgro.cpp" \
+    "../Cons/lanac.cpp" \
+    "../Cons/mapa.cpp" \
+    "../Cons/mreza.cpp" \
     "../Cons/oblik.cpp" \
-    "../Cons/tacka.cpp"
+    "../Cons/paralelno.cpp" \
+    "../Cons/scena.cpp" \
+    "../Cons/tacka.cpp" \
+    "../Cons/uprosti.cpp"
 
 HEADERS += \
     catch.hpp \
     "../Cons/afin.hpp" \
     "../Cons/alijasi.hpp" \
     "../Cons/geom.hpp" \
+    "../Cons/indeks.hpp" \
+    "../Cons/jezgro.hpp" \
+    "../Cons/lanac.hpp" \
+    "../Cons/mapa.hpp" \
+    "../Cons/mreza.hpp" \
     "../Cons/oblik.hpp" \
+    "../Cons/okvir.hpp" \
+    "../Cons/paralelno.hpp" \
+    "../Cons/scena.hpp" \
     "../Cons/tacka.hpp" \
+    "../Cons/uprosti.hpp" \
     "../Cons/util.hpp"
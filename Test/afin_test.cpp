@@ -191,3 +191,22 @@ SCENARIO("Moguce je konstruisati refleksiju", "[refl]"){
         REQUIRE(geom::refl(u, t) == geom::refl(u, t[0], t[1]));
     }
 }
+
+SCENARIO("Centrirane transformacije su u zatvorenom obliku", "[centar]"){
+    GIVEN("Centar transformacije i bool"){
+        const auto x = GENERATE_REF(-13.5, 0., 1.5, 100.);
+        const auto y = GENERATE_REF(-7.1, 0., 17.);
+        const auto inv = GENERATE_REF(true, false);
+
+        WHEN("Transformacija se centrira"){
+            const auto centriraj = [x, y](geom::geom g){
+                return geom::trans(x, y) * g * geom::trans(-x, -y);
+            };
+
+            CHECK(geom::skal(2, -0.5, x, y, inv) == centriraj(geom::skal(2, -0.5, 0, 0, inv)));
+            CHECK(geom::smic(0.3, 1.2, x, y, inv) == centriraj(geom::smic(0.3, 1.2, 0, 0, inv)));
+            CHECK(geom::rot(37, x, y, inv) == centriraj(geom::rot(37, 0, 0, inv)));
+            REQUIRE(geom::refl(-61, x, y, inv) == centriraj(geom::refl(-61, 0, 0, inv)));
+        }
+    }
+}
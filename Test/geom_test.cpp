@@ -396,6 +396,9 @@ SCENARIO("Moguce je upisati transformaciju sa ulaznog toka", "[ulaz]"){
 
         WHEN("Upisuje se sa ispravnog toka"){
             REQUIRE(static_cast<bool>(s1 >> k));
+            REQUIRE(k == geom::geom{{1, 2, 3},
+                                    {4, 5, 6},
+                                    {0, 0, 1}});
         }
 
         WHEN("Upisuje se sa neispravnog toka"){
@@ -0,0 +1,203 @@
+#include "catch.hpp"
+
+#include <random>
+#include <set>
+
+#include "../Cons/afin.hpp"
+#include "../Cons/indeks.hpp"
+
+namespace {
+
+// Nasumicni mali poligoni rasuti po ravni
+std::vector<geom::poly> poligoni(const std::size_t n, const unsigned seme)
+{
+    std::mt19937 gen(seme);
+    std::uniform_real_distribution<> polozaj(-1000, 1000);
+    std::uniform_real_distribution<> velicina(0, 10);
+
+    std::vector<geom::poly> rez;
+    rez.reserve(n);
+    for (std::size_t i = 0; i < n; i++){
+        const auto x = polozaj(gen), y = polozaj(gen);
+        rez.push_back(geom::poly{{x, y},
+                                 {x + velicina(gen), y},
+                                 {x, y + velicina(gen)}});
+    }
+
+    return rez;
+}
+
+// Pretraga grubom silom, radi poredjenja
+std::set<const geom::oblik*> sece(const std::vector<const geom::oblik*>& oblici,
+                                  const geom::Okvir& okvir)
+{
+    std::set<const geom::oblik*> rez;
+    for (const auto o : oblici){
+        if (o->okvir().sece(okvir)){
+            rez.insert(o);
+        }
+    }
+
+    return rez;
+}
+
+// Skup rezultata pretrage indeksa
+std::set<const geom::oblik*> skup(const std::vector<const geom::oblik*>& niz)
+{
+    return {std::cbegin(niz), std::cend(niz)};
+}
+
+}
+
+SCENARIO("Okvir oblika obuhvata celu krivu", "[indeks]"){
+    GIVEN("Osno poravnata i zarotirana elipsa i krug"){
+        const geom::elipsa e({1, 2}, 3, 4);
+        const geom::elipsa r({0, 0}, {3, 3}, {-1, 1});
+        const geom::krug k({1, 1}, {4, 5});
+
+        THEN("Okviri su tacni"){
+            CHECK(e.okvir() == geom::Okvir{-2, -2, 4, 6});
+            CHECK(r.okvir().max_x == Approx(std::sqrt(10)));
+            CHECK(r.okvir().min_y == Approx(-std::sqrt(10)));
+            CHECK(k.okvir() == geom::Okvir{-4, -4, 6, 6});
+            REQUIRE(geom::poly{}.okvir().prazan());
+        }
+    }
+}
+
+SCENARIO("Prostorni indeks se poklapa sa grubom silom", "[indeks]"){
+    GIVEN("Mnostvo malih poligona"){
+        auto oblici = poligoni(20000, 3);
+        std::vector<const geom::oblik*> pokazivaci;
+        for (const auto& p : oblici){
+            pokazivaci.push_back(&p);
+        }
+
+        std::mt19937 gen(5);
+        std::uniform_real_distribution<> polozaj(-1100, 1100);
+        std::uniform_real_distribution<> velicina(0, 200);
+
+        const auto proveri = [&](const geom::indeks& ind,
+                                 const std::vector<const geom::oblik*>& prisutni){
+            bool isti = ind.size() == prisutni.size();
+            for (auto i = 0; isti && i < 50; i++){
+                const auto x = polozaj(gen), y = polozaj(gen);
+                const geom::Okvir okvir{x, y, x + velicina(gen), y + velicina(gen)};
+                isti = skup(ind.trazi(okvir)) == sece(prisutni, okvir);
+            }
+            return isti;
+        };
+
+        WHEN("Indeks se napuni pakovanjem"){
+            const geom::indeks ind(pokazivaci);
+
+            THEN("Pretrage su iste"){
+                CHECK(ind.visina() == 4);
+                CHECK(proveri(ind, pokazivaci));
+
+                geom::Okvir svi;
+                for (const auto o : pokazivaci){
+                    svi.prosiri(o->okvir());
+                }
+                REQUIRE(ind.okvir() == svi);
+            }
+
+            THEN("Najblizi oblici su redom najblizi"){
+                const geom::tacka t(12.5, -30);
+                const auto najblizi = ind.najblizi(t, 10);
+                REQUIRE(najblizi.size() == 10);
+
+                std::vector<double> rastojanja;
+                for (const auto o : pokazivaci){
+                    rastojanja.push_back(o->okvir().rastojanje2(12.5, -30));
+                }
+                std::sort(std::begin(rastojanja), std::end(rastojanja));
+
+                bool isti = true;
+                for (auto i = 0; i < 10; i++){
+                    isti &= najblizi[i]->okvir().rastojanje2(12.5, -30) == rastojanja[i];
+                }
+                REQUIRE(isti);
+            }
+        }
+
+        WHEN("Indeks se gradi i menja postepeno"){
+            geom::indeks ind;
+            for (const auto o : pokazivaci){
+                ind.dodaj(o);
+            }
+            CHECK(proveri(ind, pokazivaci));
+
+            // Uklanjanje svakog drugog oblika
+            std::vector<const geom::oblik*> ostali;
+            bool uklonjeni = true;
+            for (std::size_t i = 0; i < pokazivaci.size(); i++){
+                if (i % 2){
+                    uklonjeni &= ind.ukloni(pokazivaci[i]);
+                } else {
+                    ostali.push_back(pokazivaci[i]);
+                }
+            }
+            CHECK(uklonjeni);
+            CHECK_FALSE(ind.ukloni(pokazivaci[1]));
+            CHECK(proveri(ind, ostali));
+
+            // Pomeranje oblika i azuriranje
+            for (std::size_t i = 0; i < ostali.size(); i += 3){
+                oblici[2*i].transformisi(geom::trans(500, 0));
+                ind.azuriraj(&oblici[2*i]);
+            }
+            CHECK(proveri(ind, ostali));
+
+            // Uklanjanje svih oblika
+            for (const auto o : ostali){
+                ind.ukloni(o);
+            }
+            CHECK(ind.empty());
+            CHECK(ind.visina() == 1);
+            REQUIRE(ind.trazi(geom::Okvir{-1e9, -1e9, 1e9, 1e9}).empty());
+        }
+    }
+}
+
+SCENARIO("Oblici bez tacaka se ne indeksiraju", "[indeks]"){
+    GIVEN("Prazni poligoni medju punim"){
+        auto oblici = poligoni(100, 3);
+        std::vector<geom::poly> prazni(50);
+
+        std::vector<const geom::oblik*> pokazivaci;
+        for (std::size_t i = 0; i < oblici.size(); i++){
+            pokazivaci.push_back(&oblici[i]);
+            if (i < prazni.size()){
+                pokazivaci.push_back(&prazni[i]);
+            }
+        }
+
+        WHEN("Indeks se napuni pakovanjem"){
+            const geom::indeks ind(pokazivaci);
+
+            THEN("Samo puni oblici su u indeksu"){
+                CHECK(ind.size() == oblici.size());
+                REQUIRE(ind.trazi(geom::Okvir{-1e9, -1e9, 1e9, 1e9}).size() == oblici.size());
+            }
+        }
+
+        WHEN("Oblici se dodaju i azuriraju"){
+            geom::indeks ind;
+            for (const auto o : pokazivaci){
+                ind.dodaj(o);
+            }
+            CHECK(ind.size() == oblici.size());
+
+            // Prazan oblik dobija tacku, a pun ostaje bez njih
+            prazni[0].dodaj({0, 0});
+            ind.azuriraj(&prazni[0]);
+            oblici[0] = geom::poly{};
+            ind.azuriraj(&oblici[0]);
+
+            CHECK(ind.size() == oblici.size());
+            CHECK(skup(ind.trazi(geom::tacka(0, 0))).count(&prazni[0]));
+            REQUIRE(ind.trazi(geom::Okvir{-1e9, -1e9, 1e9, 1e9}).size() == oblici.size());
+        }
+    }
+}
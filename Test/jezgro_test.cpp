@@ -0,0 +1,103 @@
+#include "catch.hpp"
+
+#include "../Cons/afin.hpp"
+#include "../Cons/jezgro.hpp"
+#include "../Cons/paralelno.hpp"
+
+SCENARIO("Moguca je paketna primena transformacije", "[jezgro]"){
+    GIVEN("Niz tacaka i transformacija"){
+        geom::NizTacaka niz;
+        for (auto i = 0; i < 100; i++){
+            niz.emplace_back(i*1.5-20, 30-i*0.7);
+        }
+
+        const auto g = geom::rot(30, 1, 2) *
+                       geom::skal(2, 0.5) *
+                       geom::trans(-3, 4);
+
+        auto ocekivano = niz;
+        for (auto& t : ocekivano){
+            t.primeni(g);
+        }
+
+        WHEN("Primenjuje se na niz tacaka"){
+            geom::primeni(g, niz);
+            REQUIRE(niz == ocekivano);
+        }
+
+        WHEN("Primenjuje se na parove koordinata"){
+            std::vector<geom::Element> xy;
+            for (const auto& t : niz){
+                xy.push_back(t[0]);
+                xy.push_back(t[1]);
+            }
+
+            geom::primeni(g, xy.data(), niz.size());
+
+            for (geom::Velicina i = 0; i < std::size(niz); i++){
+                CHECK(geom::tacka(xy[2*i], xy[2*i+1]) == ocekivano[i]);
+            }
+        }
+
+        WHEN("Primenjuje se na odvojene nizove"){
+            std::vector<geom::Element> xs, ys;
+            for (const auto& t : niz){
+                xs.push_back(t[0]);
+                ys.push_back(t[1]);
+            }
+
+            geom::primeni(g, xs.data(), ys.data(), niz.size());
+
+            for (geom::Velicina i = 0; i < std::size(niz); i++){
+                CHECK(geom::tacka(xs[i], ys[i]) == ocekivano[i]);
+            }
+        }
+
+        WHEN("Niz je prazan"){
+            geom::NizTacaka prazan;
+            geom::primeni(g, prazan);
+            REQUIRE(prazan.empty());
+        }
+    }
+}
+
+SCENARIO("Skup instrukcija se moze menjati tokom paralelne primene", "[jezgro]"){
+    GIVEN("Niz tacaka koji obradjuju radne niti"){
+        geom::NizTacaka niz;
+        for (auto i = 0; i < 1 << 12; i++){
+            niz.emplace_back(i*0.25, -i*0.5);
+        }
+
+        const auto g = geom::rot(45) * geom::skal(3, 2);
+        auto ocekivano = niz;
+        for (auto& t : ocekivano){
+            t.primeni(g);
+        }
+
+        WHEN("Izbor se menja dok niti rade"){
+            const auto najbolji = geom::podrzane();
+            geom::bazen b(4);
+
+            bool isti = true;
+            for (auto k = 0; k < 20; k++){
+                std::vector<geom::NizTacaka> nizovi(8, niz);
+                b.izvrsi(nizovi.size() + 1, [&](const geom::Velicina i){
+                    if (i == nizovi.size()){
+                        geom::koristi(k % 2 ? geom::Instrukcije::skalarne : najbolji);
+                    } else {
+                        geom::primeni(g, nizovi[i]);
+                    }
+                });
+
+                for (const auto& n : nizovi){
+                    isti &= n == ocekivano;
+                }
+                geom::koristi(k % 2 ? najbolji : geom::Instrukcije::skalarne);
+            }
+
+            geom::koristi(najbolji);
+            CHECK(isti);
+            REQUIRE(geom::instrukcije() == najbolji);
+        }
+    }
+}
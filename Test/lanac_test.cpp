@@ -0,0 +1,67 @@
+#include "catch.hpp"
+
+#include "../Cons/afin.hpp"
+#include "../Cons/lanac.hpp"
+
+SCENARIO("Moguce je slagati transformacije u lanac", "[lanac]"){
+    GIVEN("Nekoliko transformacija"){
+        const geom::rot r(90, {1, 1});
+        const geom::trans t(2, -3);
+        const geom::skal s(2, 0.5);
+
+        const geom::poly p{{1, 0}, {2, 1}, {-1, 3}};
+
+        WHEN("Lanac je prazan"){
+            const geom::lanac l;
+            CHECK(l.size() == 0);
+            REQUIRE(l.ukupno() == geom::geom());
+        }
+
+        WHEN("Lanac se primenjuje na oblik"){
+            geom::lanac l;
+            l.dodaj(r).dodaj(t).dodaj(s);
+
+            CHECK(l.size() == 3);
+            CHECK(l.koraci().empty());
+            CHECK(l.ukupno() == s * t * r);
+
+            auto a = p;
+            l.primeni(a);
+
+            auto b = p;
+            b.transformisi(r);
+            b.transformisi(t);
+            b.transformisi(s);
+
+            CHECK(a.tacke() == b.tacke());
+
+            l.isprazni();
+            CHECK(l.size() == 0);
+            REQUIRE(l.ukupno() == geom::geom());
+        }
+
+        WHEN("Lanac je u rezimu otklanjanja gresaka"){
+            geom::lanac l(true);
+            l.dodaj(r).dodaj(t).dodaj(s);
+
+            CHECK(l.debug());
+            CHECK(l.koraci().size() == 3);
+
+            const auto m = l.medjurezultati(p.tacke());
+            CHECK(m.size() == 3);
+
+            auto a = p;
+            a.transformisi(r);
+            CHECK(m[0] == a.tacke());
+
+            auto b = p.tacke();
+            l.primeni(b);
+            REQUIRE(m[2] == b);
+        }
+
+        WHEN("Lanac ne cuva korake"){
+            const geom::lanac l;
+            REQUIRE_THROWS_AS(l.medjurezultati(p.tacke()), geom::Exc);
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#include "catch.hpp"
+
+#include <random>
+
+#include "../Cons/mreza.hpp"
+
+SCENARIO("Mreza tacaka se poklapa sa grubom silom", "[mreza]"){
+    GIVEN("Mreza sa mnostvom nasumicnih tacaka"){
+        geom::mreza m(50);
+
+        std::mt19937 gen(13);
+        std::normal_distribution<> dis(0, 500);
+        bool redom = true;
+        for (auto i = 0; i < 50000; i++){
+            redom &= m.dodaj({dis(gen), dis(gen)}) == geom::Velicina(i);
+        }
+        CHECK(redom);
+        const auto& tacke = m.tacke();
+
+        WHEN("Trazi se najbliza tacka"){
+            bool isti = true;
+            for (auto i = 0; i < 200; i++){
+                const geom::tacka t(dis(gen), dis(gen));
+                const auto r = 20.0;
+
+                auto najbliza = geom::mreza::nema;
+                auto najmanje = r*r;
+                for (geom::Velicina j = 0; j < tacke.size(); j++){
+                    const auto dx = tacke[j][0] - t[0], dy = tacke[j][1] - t[1];
+                    const auto d = dx*dx + dy*dy;
+                    if (d < najmanje || (d == najmanje && najbliza == geom::mreza::nema)){
+                        najbliza = j;
+                        najmanje = d;
+                    }
+                }
+
+                isti &= m.najbliza(t, r) == najbliza;
+            }
+            REQUIRE(isti);
+        }
+
+        WHEN("Traze se tacke u okviru"){
+            const auto proveri = [&tacke, &m](const geom::Okvir& o){
+                std::vector<geom::Velicina> ocekivano;
+                for (geom::Velicina j = 0; j < tacke.size(); j++){
+                    if (o.sadrzi(tacke[j][0], tacke[j][1])){
+                        ocekivano.push_back(j);
+                    }
+                }
+                return m.u_okviru(o) == ocekivano;
+            };
+
+            CHECK(proveri({-120, -30, 75, 210}));
+            CHECK(proveri({-1e6, -1e6, 1e6, 1e6}));
+            REQUIRE(proveri({1e3, 1e3, 1e3 + 1, 1e3 + 1}));
+        }
+
+        WHEN("Mreza se isprazni"){
+            m.isprazni();
+            CHECK(m.size() == 0);
+            REQUIRE(m.najbliza({0, 0}, 1e9) == geom::mreza::nema);
+        }
+    }
+
+    GIVEN("Neispravna velicina celije"){
+        REQUIRE_THROWS_AS(geom::mreza(0), geom::Exc);
+    }
+}
@@ -1,5 +1,7 @@
 #include "catch.hpp"
 
+#include <random>
+
 #include "../Cons/afin.hpp"
 #include "../Cons/oblik.hpp"
 
@@ -96,6 +98,73 @@ SCENARIO("Moguce je konstruisati mnogougao", "[poly]"){
     }
 }
 
+SCENARIO("Konveksni omot se racuna u mestu", "[omot]"){
+    GIVEN("Kvadrat sa unutrasnjim tackama"){
+        geom::poly a({{ 1.,  1.},
+                      {-1., -1.},
+                      { 0.,  1.},
+                      { 1., -1.},
+                      {-1.,  1.},
+                      { 1.,  1.},
+                      {0.5, 0.5}});
+
+        WHEN("Pravi se konveksni omot"){
+            a.omot();
+
+            // Pocinje najdesnijom, a ide suprotno
+            // kazaljci na satu kroz najleviju tacku
+            REQUIRE(a.tacke() == std::vector<geom::tacka>{{ 1,  1},
+                                                          {-1,  1},
+                                                          {-1, -1},
+                                                          { 1, -1}});
+        }
+    }
+
+    GIVEN("Kolinearne tacke"){
+        geom::Matrica niz{{1, 1}, {0, 0}, {3, 3}, {2, 2}, {3, 3}};
+
+        WHEN("Pravi se konveksni omot"){
+            REQUIRE(util::konv_omot(niz) == geom::Matrica{{3, 3}, {0, 0}});
+        }
+    }
+
+    GIVEN("Nasumicne tacke"){
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<> dis(-100, 100);
+
+        std::vector<geom::tacka> niz;
+        for (auto i = 0; i < 20000; i++){
+            niz.emplace_back(dis(gen), dis(gen));
+        }
+
+        WHEN("Pravi se konveksni omot"){
+            const auto omot = util::konv_omot(niz);
+            const auto n = omot.size();
+            CHECK(n > 2);
+
+            const auto x = [](const auto& a, const auto& b){return a[0] < b[0];};
+            CHECK(omot.front() == *std::max_element(std::cbegin(niz), std::cend(niz), x));
+            CHECK(std::find(std::cbegin(omot), std::cend(omot),
+                            *std::min_element(std::cbegin(niz), std::cend(niz), x)) != std::cend(omot));
+
+            // Svaka stranica skrece ulevo i
+            // nijedna tacka nije sa njene desne strane
+            auto konveksan = true;
+            auto obuhvata = true;
+            for (std::size_t i = 0; i < n; i++){
+                const auto& u = omot[i];
+                const auto& v = omot[(i+1)%n];
+                konveksan &= util::vekt_proiz(omot[(i+2)%n], u, v) < 0;
+                for (const auto& t : niz){
+                    obuhvata &= util::vekt_proiz(t, u, v) <= 0;
+                }
+            }
+
+            CHECK(konveksan);
+            REQUIRE(obuhvata);
+        }
+    }
+}
 
 SCENARIO("Moguce je konstruisati pravilan mnogougao", "[ppoly]"){
     GIVEN("Parametri mnogougla"){
@@ -177,3 +246,67 @@ SCENARIO("Moguce je konstruisati krug", "[krug]"){
         }
     }
 }
+
+SCENARIO("Okvir oblika se cuva i azurira", "[poly]"){
+    GIVEN("Poligon sa izracunatim okvirom"){
+        geom::poly p{{1, 2}, {-3, 4}, {5, -6}};
+        REQUIRE(p.okvir() == geom::Okvir{-3, -6, 5, 4});
+
+        WHEN("Dodaje se tacka"){
+            p.dodaj({10, 0});
+            REQUIRE(p.okvir() == geom::Okvir{-3, -6, 10, 4});
+        }
+
+        WHEN("Poligon se skalira i pomera"){
+            p.transformisi(geom::skal(2, -1));
+            p.transformisi(geom::trans(1, 1));
+            CHECK(p.okvir() == geom::Okvir{-5, -3, 11, 7});
+            REQUIRE(p.okvir() == geom::poly(p.tacke()).okvir());
+        }
+
+        WHEN("Poligon se rotira"){
+            p.transformisi(geom::rot(30));
+            REQUIRE(p.okvir() == geom::poly(p.tacke()).okvir());
+        }
+
+        WHEN("Poligon se svodi na omot"){
+            p.dodaj({0, 0});
+            p.omot();
+            REQUIRE(p.okvir() == geom::poly(p.tacke()).okvir());
+        }
+    }
+
+    GIVEN("Krug sa izracunatim okvirom"){
+        geom::krug k({0, 0}, 1);
+        REQUIRE(k.okvir() == geom::Okvir{-1, -1, 1, 1});
+
+        WHEN("Krug se neravnomerno skalira"){
+            k.transformisi(geom::skal(2, 1));
+            REQUIRE(k.okvir() == geom::Okvir{-2, -2, 2, 2});
+        }
+    }
+}
+
+SCENARIO("Tip i zatvorenost oblika", "[oblik]"){
+    GIVEN("Oblici svih tipova"){
+        geom::poly p{{0, 0}, {1, 0}, {1, 1}};
+        const geom::ppoly pp({0, 0}, 5, 1);
+        const geom::elipsa e;
+        const geom::krug k;
+
+        THEN("Tip i zatvorenost dobijaju se virtuelno"){
+            const geom::oblik& o = p;
+            CHECK(o.tip() == geom::Tip::poligon);
+            CHECK_FALSE(o.zatvoren());
+            p.zatvori();
+            CHECK(o.zatvoren());
+
+            CHECK(pp.tip() == geom::Tip::poligon);
+            CHECK(pp.zatvoren());
+            CHECK(e.tip() == geom::Tip::elipsa);
+            CHECK(e.zatvoren());
+            CHECK(k.tip() == geom::Tip::krug);
+            REQUIRE(k.zatvoren());
+        }
+    }
+}
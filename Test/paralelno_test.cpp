@@ -0,0 +1,209 @@
+#include "catch.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+#include "../Cons/afin.hpp"
+#include "../Cons/jezgro.hpp"
+#include "../Cons/paralelno.hpp"
+
+SCENARIO("Moguce je paralelno izvrsavati zadatke", "[bazen]"){
+    GIVEN("Bazen sa vise niti"){
+        const auto n = GENERATE(1, 2, 4);
+        geom::bazen b(n);
+        CHECK(b.size() == geom::Velicina(n));
+
+        WHEN("Izvrsava se vise zadataka"){
+            std::vector<int> rez(1000, 0);
+            b.izvrsi(rez.size(), [&rez](const geom::Velicina i){rez[i] = i*2;});
+
+            for (geom::Velicina i = 0; i < rez.size(); i++){
+                CHECK(rez[i] == int(i*2));
+            }
+        }
+
+        WHEN("Zadaci su ugnjezdeni"){
+            std::atomic<int> brojac{0};
+            b.izvrsi(10, [&b, &brojac](const geom::Velicina)
+                         {b.izvrsi(10, [&brojac](const geom::Velicina){brojac++;});});
+
+            REQUIRE(brojac == 100);
+        }
+
+        WHEN("Neki zadatak izbaci izuzetak"){
+            REQUIRE_THROWS_AS(b.izvrsi(100, [](const geom::Velicina i)
+                                            {if (i == 42) throw geom::Exc("Greska!");}),
+                              geom::Exc);
+
+            std::atomic<int> brojac{0};
+            b.izvrsi(100, [&brojac](const geom::Velicina){brojac++;});
+            REQUIRE(brojac == 100);
+        }
+    }
+}
+
+SCENARIO("Paralelna transformacija se poklapa sa serijskom", "[paralelno]"){
+    GIVEN("Veliki niz tacaka i bazen niti"){
+        geom::NizTacaka niz;
+        for (auto i = 0; i < 100003; i++){
+            niz.emplace_back(i*0.01-500, 300-i*0.007);
+        }
+
+        const auto g = geom::rot(17, {5, -3}) * geom::skal(1.1, 0.9);
+        geom::bazen b(4);
+
+        WHEN("Transformise se niz tacaka"){
+            auto serijski = niz;
+            geom::primeni(g, serijski);
+
+            geom::primeni(g, niz, b);
+
+            bool isti = true;
+            for (geom::Velicina i = 0; i < niz.size(); i++){
+                isti &= niz[i].koord() == serijski[i].koord();
+            }
+            REQUIRE(isti);
+        }
+
+        WHEN("Transformise se scena oblika"){
+            std::vector<geom::poly> oblici;
+            oblici.emplace_back(niz);
+            for (auto i = 0; i < 50; i++){
+                oblici.push_back({{1.*i, 2.}, {3., 1.*i}, {-1.*i, 0.}});
+            }
+
+            auto serijski = oblici;
+            for (auto& o : serijski){
+                o.transformisi(g);
+            }
+
+            std::vector<geom::oblik*> scena;
+            for (auto& o : oblici){
+                scena.push_back(&o);
+            }
+
+            geom::transformisi(g, scena, b);
+
+            bool isti = true;
+            for (geom::Velicina i = 0; i < oblici.size(); i++){
+                const auto& a = oblici[i].tacke();
+                const auto& s = serijski[i].tacke();
+                for (geom::Velicina j = 0; j < a.size(); j++){
+                    isti &= a[j].koord() == s[j].koord();
+                }
+            }
+            REQUIRE(isti);
+        }
+    }
+}
+
+SCENARIO("Paralelni konveksni omot se poklapa sa serijskim", "[paralelno]"){
+    GIVEN("Oblak tacaka i bazen niti"){
+        const auto n = GENERATE(1, 2, 4);
+        geom::bazen b(n);
+
+        std::mt19937 gen(7);
+        std::normal_distribution<> dis(0, 100);
+
+        geom::NizTacaka niz;
+        for (auto i = 0; i < 200003; i++){
+            niz.emplace_back(dis(gen), dis(gen));
+        }
+
+        // Tacke na krugu, razbacane po svim delovima,
+        // pa su i omoti delova veliki
+        for (auto i = 0; i < 1000; i++){
+            niz.emplace_back(1000*cos(i*0.001), 1000*sin(i*0.001));
+        }
+        std::shuffle(std::begin(niz), std::end(niz), gen);
+
+        WHEN("Pravi se konveksni omot"){
+            geom::poly serijski(niz);
+            serijski.omot();
+
+            geom::poly paralelni(niz);
+            paralelni.omot(b);
+
+            REQUIRE(paralelni.tacke() == serijski.tacke());
+        }
+
+        WHEN("Tacaka je malo"){
+            geom::NizTacaka malo(std::cbegin(niz), std::cbegin(niz)+5);
+            const auto serijski = util::konv_omot(malo);
+
+            geom::omot(malo, b);
+            REQUIRE(malo == serijski);
+        }
+    }
+}
+
+SCENARIO("Paralelno ucitavanje scene se poklapa sa serijskim", "[paralelno]"){
+    GIVEN("Velika scena i bazen niti"){
+        const auto n = GENERATE(1, 4);
+        geom::bazen b(n);
+
+        std::mt19937 gen(11);
+        std::normal_distribution<> dis(0, 100);
+        std::uniform_int_distribution<> vel(3, 40);
+
+        // Scena veca od nekoliko delova
+        std::vector<std::unique_ptr<geom::oblik>> oblici;
+        for (auto i = 0; i < 20000; i++){
+            geom::NizTacaka tacke;
+            const auto tip = static_cast<geom::Tip>(i % 3);
+            const auto m = tip == geom::Tip::poligon ? vel(gen) : tip == geom::Tip::elipsa ? 3 : 2;
+            for (auto j = 0; j < m; j++){
+                tacke.emplace_back(dis(gen), dis(gen));
+            }
+            oblici.push_back(geom::napravi(tip, std::move(tacke)));
+        }
+
+        std::vector<const geom::oblik*> pokazivaci;
+        for (const auto& o : oblici){
+            pokazivaci.push_back(o.get());
+        }
+
+        const auto isti = [&oblici](const geom::Scena& scena){
+            bool rez = scena.size() == oblici.size();
+            for (geom::Velicina i = 0; rez && i < scena.size(); i++){
+                rez = scena[i]->tip() == oblici[i]->tip() &&
+                      scena[i]->tacke() == oblici[i]->tacke();
+            }
+            return rez;
+        };
+
+        WHEN("Tekstualna scena se ucita paralelno"){
+            const std::string putanja = "paralelno_test.txt";
+            {
+                std::ofstream izlaz(putanja);
+                for (const auto o : pokazivaci){
+                    geom::pisi_tekst(izlaz, *o);
+                }
+            }
+
+            CHECK(isti(geom::ucitaj_tekst(putanja, b)));
+
+            // Greska se prijavljuje sa tacnim redom
+            std::ofstream(putanja, std::ios::app) << "krug:[1, 2]\n";
+            try {
+                geom::ucitaj_tekst(putanja, b);
+                FAIL("Greska nije prijavljena!");
+            } catch (const geom::Exc& e){
+                CHECK(std::string(e.what()).find("red 20001") != std::string::npos);
+            }
+
+            std::remove(putanja.c_str());
+        }
+
+        WHEN("Binarna scena se ucita paralelno"){
+            const std::string putanja = "paralelno_test.gsc";
+            geom::sacuvaj_binarno(putanja, pokazivaci);
+
+            CHECK(isti(geom::ucitaj_binarno(putanja, b)));
+
+            std::remove(putanja.c_str());
+        }
+    }
+}
@@ -0,0 +1,260 @@
+#include "catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "../Cons/afin.hpp"
+#include "../Cons/scena.hpp"
+
+SCENARIO("Moguce je sacuvati i ucitati binarnu scenu", "[scena]"){
+    GIVEN("Scena sa svim tipovima oblika"){
+        geom::poly p{{1, 2}, {3.14159265358979, -4}, {5, 6}};
+        p.zatvori();
+        geom::poly q{{0, 0}, {1, 1}};
+        const geom::elipsa e({50, 50}, {150, 50}, {50, 100});
+        const geom::krug k({-1.5, 2.25}, 1e-7);
+        const geom::ppoly pp({0, 0}, 5, 2);
+
+        const std::vector<const geom::oblik*> oblici{&p, &e, &q, &k, &pp};
+        const std::string putanja = "scena_test.gsc";
+
+        WHEN("Scena se sacuva i ucita"){
+            geom::sacuvaj_binarno(putanja, oblici);
+
+            const geom::binarna_scena b(putanja);
+            CHECK(b.size() == 5);
+            CHECK(b.tacaka() == 3+3+2+2+5);
+
+            CHECK(b.tip(0) == geom::Tip::poligon);
+            CHECK(b.tip(1) == geom::Tip::elipsa);
+            CHECK(b.tip(3) == geom::Tip::krug);
+            CHECK(b.tip(4) == geom::Tip::poligon);
+            CHECK(b.zatvoren(0));
+            CHECK_FALSE(b.zatvoren(2));
+            CHECK(b.koordinate(0)[2] == 3.14159265358979);
+
+            const auto scena = geom::ucitaj_binarno(putanja);
+            REQUIRE(scena.size() == oblici.size());
+
+            // Koordinate su sacuvane bez gubitka
+            bool isti = true;
+            for (geom::Velicina i = 0; i < scena.size(); i++){
+                CHECK(scena[i]->tip() == oblici[i]->tip());
+                const auto& a = scena[i]->tacke();
+                const auto& c = oblici[i]->tacke();
+                isti &= a.size() == c.size();
+                for (geom::Velicina j = 0; isti && j < a.size(); j++){
+                    isti &= a[j].koord() == c[j].koord();
+                }
+            }
+            CHECK(isti);
+
+            CHECK_FALSE(dynamic_cast<const geom::poly&>(*scena[2]).zatvoren());
+            REQUIRE(dynamic_cast<const geom::poly&>(*scena[4]).zatvoren());
+        }
+
+        WHEN("Scena je prazna"){
+            geom::sacuvaj_binarno(putanja, {});
+            REQUIRE(geom::ucitaj_binarno(putanja).empty());
+        }
+
+        WHEN("Datoteka nije ispravna"){
+            geom::sacuvaj_binarno(putanja, oblici);
+
+            // Odsecena datoteka
+            std::ifstream ulaz(putanja, std::ios::binary);
+            std::string sadrzaj((std::istreambuf_iterator<char>(ulaz)),
+                                 std::istreambuf_iterator<char>());
+            ulaz.close();
+            std::ofstream(putanja, std::ios::binary).write(sadrzaj.data(), sadrzaj.size()-8);
+            CHECK_THROWS_AS(geom::binarna_scena(putanja), geom::Exc);
+
+            // Pogresna magija
+            sadrzaj[0] = 'X';
+            std::ofstream(putanja, std::ios::binary).write(sadrzaj.data(), sadrzaj.size());
+            CHECK_THROWS_AS(geom::binarna_scena(putanja), geom::Exc);
+
+            // Nepostojeca datoteka
+            REQUIRE_THROWS_AS(geom::binarna_scena("nema_je.gsc"), geom::Exc);
+        }
+
+        WHEN("Putanja sadrzi nasa slova"){
+            // "Učitajte" u UTF-8
+            const std::string nasa = "U\xc4\x8ditajte_scena_test.gsc";
+            geom::sacuvaj_binarno(nasa, oblici);
+            CHECK(geom::ucitaj_binarno(nasa).size() == oblici.size());
+            std::remove(nasa.c_str());
+        }
+
+        std::remove(putanja.c_str());
+    }
+
+    GIVEN("Tacke za pravljenje oblika"){
+        geom::NizTacaka tacke{{1, 2}, {3, 4}};
+
+        WHEN("Broj tacaka ne odgovara tipu"){
+            CHECK_THROWS_AS(geom::napravi(geom::Tip::elipsa, geom::NizTacaka(tacke)), geom::Exc);
+            REQUIRE_NOTHROW(geom::napravi(geom::Tip::krug, std::move(tacke)));
+        }
+    }
+}
+
+SCENARIO("Tekstualna scena se cita postepeno", "[scena]"){
+    GIVEN("Scena u postojecem tekstualnom formatu"){
+        std::istringstream ulaz(
+            "elipsa:[50.00, 50.00, 1.00];[150.00, 50.00, 1.00];[50.00, 100.00, 1.00]\n"
+            "krug:[50.00, 50.00, 1.00];[150.00, 50.00, 1.00]\r\n"
+            "\n"
+            "poligon:[100.00, 100.00, 1.00];[-100.00, 100.00, 1.00];[-100.00, -100.00, 1.00]\n");
+
+        WHEN("Scena se procita"){
+            std::vector<geom::Tip> tipovi;
+            geom::Velicina tacaka = 0;
+            const auto n = geom::citaj_tekst(ulaz, [&](std::unique_ptr<geom::oblik> o){
+                tipovi.push_back(o->tip());
+                tacaka += o->tacke().size();
+            });
+
+            THEN("Oblici se obradjuju redom"){
+                CHECK(n == 3);
+                CHECK(tacaka == 3+2+3);
+                REQUIRE(tipovi == std::vector<geom::Tip>{geom::Tip::elipsa,
+                                                          geom::Tip::krug,
+                                                          geom::Tip::poligon});
+            }
+        }
+    }
+
+    GIVEN("Scena sa svim tipovima oblika"){
+        geom::poly p{{1, 2}, {-3, 4.25}, {5, 6}};
+        p.zatvori();
+        const geom::elipsa e({50, 50}, {150, 50}, {50, 100});
+        const geom::krug k({-1.5, 2.25}, {0, 0});
+
+        WHEN("Scena se upise i procita"){
+            std::stringstream tok;
+            for (const geom::oblik* o : {static_cast<const geom::oblik*>(&p),
+                                         static_cast<const geom::oblik*>(&e),
+                                         static_cast<const geom::oblik*>(&k)}){
+                geom::pisi_tekst(tok, *o);
+            }
+
+            geom::Scena scena;
+            geom::citaj_tekst(tok, [&scena](std::unique_ptr<geom::oblik> o){
+                scena.push_back(std::move(o));
+            });
+
+            THEN("Oblici su isti"){
+                REQUIRE(scena.size() == 3);
+                CHECK(scena[0]->tacke() == p.tacke());
+                CHECK(scena[1]->tacke() == e.tacke());
+                CHECK(scena[2]->tacke() == k.tacke());
+                REQUIRE(dynamic_cast<const geom::poly&>(*scena[0]).zatvoren());
+            }
+        }
+    }
+
+    GIVEN("Neispravne scene"){
+        const auto citaj = [](const std::string& niska){
+            std::istringstream ulaz(niska);
+            return geom::citaj_tekst(ulaz, [](std::unique_ptr<geom::oblik>){});
+        };
+
+        THEN("Greska se prijavljuje izuzetkom"){
+            CHECK(citaj("") == 0);
+            CHECK_THROWS_AS(citaj("kvadrat:[1, 2]\n"), geom::Exc);
+            CHECK_THROWS_AS(citaj("poligon [1, 2]\n"), geom::Exc);
+            CHECK_THROWS_AS(citaj("poligon:[1, 2];[3 4]\n"), geom::Exc);
+            CHECK_THROWS_AS(citaj("poligon:[1, 2][3, 4]\n"), geom::Exc);
+            REQUIRE_THROWS_AS(citaj("krug:[1, 2]\n"), geom::Exc);
+        }
+
+        THEN("Pogresan broj tacaka se prijavljuje uz broj reda"){
+            std::string poruka;
+            try {
+                citaj("krug:[0, 0];[1, 0]\n\nelipsa:[1, 2];[3, 4]\n");
+            } catch (const geom::Exc& e){
+                poruka = e.what();
+            }
+            CHECK(poruka.find("red 3") != std::string::npos);
+            REQUIRE(poruka.find("Elipsa nema tri tacke") != std::string::npos);
+        }
+    }
+}
+
+SCENARIO("Tekstualna scena cuva punu preciznost", "[scena]"){
+    GIVEN("Poligon sa koordinatama koje nisu zaokruzene"){
+        const geom::poly p{{0.1 + 0.2, -1e-300}, {3.141592653589793, 2.0/3}, {-0.001, 1e15}};
+        const std::string putanja = "scena_test.txt";
+
+        WHEN("Poligon se upise u punoj preciznosti"){
+            geom::sacuvaj_tekst(putanja, {&p});
+
+            geom::Scena scena;
+            const auto n = geom::ucitaj_tekst(putanja, [&scena](std::unique_ptr<geom::oblik> o){
+                scena.push_back(std::move(o));
+            });
+
+            THEN("Koordinate se citaju bez gubitka"){
+                REQUIRE(n == 1);
+                REQUIRE(scena.front()->tacke().size() == 3);
+                bool isti = true;
+                for (geom::Velicina i = 0; i < 3; i++){
+                    isti &= scena.front()->tacke()[i].koord() == p.tacke()[i].koord();
+                }
+                REQUIRE(isti);
+            }
+        }
+
+        WHEN("Datoteka se ne moze napraviti"){
+            REQUIRE_THROWS_AS(geom::sacuvaj_tekst("nema/ovog/direktorijuma.txt", {&p}),
+                              geom::Exc);
+        }
+
+        WHEN("Poligon se upise sa dve decimale"){
+            std::ostringstream izlaz;
+            geom::pisi_tekst(izlaz, p, geom::Preciznost::dve_decimale);
+
+            THEN("Izlaz je isti kao raniji"){
+                std::string ocekivano = "poligon:";
+                for (geom::Velicina i = 0; i < 3; i++){
+                    ocekivano += (i ? ";" : "") + p.tacke()[i].str();
+                }
+                REQUIRE(izlaz.str() == ocekivano + "\n");
+            }
+        }
+
+        std::remove(putanja.c_str());
+    }
+
+    GIVEN("Bafer sa vise redova"){
+        const std::string bafer = "krug:[1, 2];[3, 4]\n\n  \npoligon:[1e3, -2.5, 2]";
+
+        WHEN("Bafer se parsira bez kopiranja"){
+            std::vector<geom::NizTacaka> tacke;
+            geom::citaj_tekst(bafer.data(), bafer.data() + bafer.size(),
+                              [&tacke](std::unique_ptr<geom::oblik> o){
+                tacke.push_back(o->tacke());
+            });
+
+            THEN("Homogene koordinate se uzimaju u obzir"){
+                REQUIRE(tacke.size() == 2);
+                REQUIRE(tacke[1].size() == 1);
+                CHECK(tacke[1][0][0] == 500);
+                REQUIRE(tacke[1][0][1] == -1.25);
+            }
+        }
+
+        WHEN("Neki red nije ispravan"){
+            const std::string los = bafer + "\nkrug:[1, 2];[3, x]";
+            try {
+                geom::citaj_tekst(los.data(), los.data() + los.size(),
+                                  [](std::unique_ptr<geom::oblik>){});
+                FAIL("Greska nije prijavljena!");
+            } catch (const geom::Exc& e){
+                REQUIRE(std::string(e.what()).find("red 5") != std::string::npos);
+            }
+        }
+    }
+}
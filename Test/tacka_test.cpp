@@ -3,6 +3,7 @@
 #include <sstream>
 
 #include "../Cons/afin.hpp"
+#include "../Cons/jezgro.hpp"
 
 SCENARIO("Moguce je konstruisati tacke", "[ctor]"){
     SECTION("Konstruktor bez argumenta"){
@@ -391,3 +392,75 @@ SCENARIO("Moguce je mnozenje matrice i tacke", "[mult]"){
         REQUIRE(g*t == t);
     }
 }
+
+SCENARIO("Tacka se cuva bez dinamicke alokacije", "[memorija]"){
+    GIVEN("Neka tacka"){
+        const geom::tacka t(1, 2);
+
+        CHECK(sizeof(t) == 2*sizeof(geom::Element));
+        CHECK(t.koord() == geom::Koordinate{1, 2});
+        REQUIRE(t.mat() == geom::Vektor{1, 2, 1});
+    }
+}
+
+SCENARIO("Paketna primena se poklapa sa primenom na tacku", "[simd]"){
+    GIVEN("Niz tacaka i lanac transformacija"){
+        geom::NizTacaka niz;
+        for (auto i = 0; i < 37; i++){
+            niz.emplace_back(i*1.25-20, 17-i*0.3);
+        }
+
+        const auto g = geom::rot(35, {2, -1}) *
+                       geom::skal(1.5, 0.25, {1, 1}) *
+                       geom::smic(0.5, -0.2);
+
+        // Skalarna primena na pojedinacne tacke; sva
+        // jezgra racunaju istim redosledom, pa se
+        // rezultati porede tacno, a ne uz toleranciju
+        auto ocekivano = niz;
+        for (auto& t : ocekivano){
+            t.primeni(g);
+        }
+
+        const auto prethodni = geom::instrukcije();
+        const auto skup = GENERATE(geom::Instrukcije::skalarne,
+                                   geom::Instrukcije::sse2,
+                                   geom::Instrukcije::avx2);
+
+        if (skup > geom::podrzane()){
+            REQUIRE_THROWS_AS(geom::koristi(skup), geom::Exc);
+        } else {
+            geom::koristi(skup);
+
+            WHEN("Primenjuje se na niz tacaka"){
+                geom::primeni(g, niz);
+
+                bool isti = true;
+                for (geom::Velicina i = 0; i < std::size(niz); i++){
+                    isti &= niz[i].koord() == ocekivano[i].koord();
+                }
+                CHECK(isti);
+            }
+
+            WHEN("Primenjuje se na odvojene nizove"){
+                std::vector<geom::Element> xs, ys;
+                for (const auto& t : niz){
+                    xs.push_back(t[0]);
+                    ys.push_back(t[1]);
+                }
+
+                geom::primeni(g, xs.data(), ys.data(), niz.size());
+
+                bool isti = true;
+                for (geom::Velicina i = 0; i < std::size(niz); i++){
+                    isti &= xs[i] == ocekivano[i][0] && ys[i] == ocekivano[i][1];
+                }
+                CHECK(isti);
+            }
+
+            REQUIRE(geom::instrukcije() == skup);
+        }
+
+        geom::koristi(prethodni);
+    }
+}
@@ -0,0 +1,117 @@
+#include "catch.hpp"
+
+#include <map>
+#include <random>
+
+#include "../Cons/uprosti.hpp"
+
+SCENARIO("Uproscavanje linija", "[uprosti]"){
+    GIVEN("Izlomljena linija sa gotovo kolinearnim temenima"){
+        const geom::NizTacaka t{{0, 0}, {1, 0.1}, {2, -0.1}, {3, 5}, {4, 6},
+                                {5, 7}, {6, 8.05}, {7, 9}};
+
+        WHEN("Uproscava se postupkom Douglas-Peucker"){
+            const auto u = geom::douglas_peucker(t, 0.5);
+
+            CHECK(u.size() == 4);
+            CHECK(u.front() == t.front());
+            CHECK(u[1] == t[2]);
+            CHECK(u[2] == t[3]);
+            REQUIRE(u.back() == t.back());
+        }
+
+        WHEN("Uproscava se postupkom Visvalingam-Whyatt"){
+            const auto u = geom::visvalingam(t, 0.5);
+
+            CHECK(u.size() == 4);
+            CHECK(u.front() == t.front());
+            CHECK(u[1] == t[2]);
+            CHECK(u[2] == t[3]);
+            REQUIRE(u.back() == t.back());
+        }
+
+        WHEN("Tolerancija je nula"){
+            CHECK(geom::douglas_peucker(t, 0).size() == t.size() - 1);
+            REQUIRE(geom::visvalingam(t, 0).size() == t.size());
+        }
+
+        WHEN("Tolerancija je ogromna"){
+            CHECK(geom::douglas_peucker(t, 1e9).size() == 2);
+            REQUIRE(geom::visvalingam(t, 1e9).size() == 2);
+        }
+    }
+
+    GIVEN("Zatvoren poligon"){
+        geom::poly p{{0, 0}, {1, 0.01}, {2, 0}, {2, 2}, {1, 2.01}, {0, 2}};
+        p.zatvori();
+
+        WHEN("Uproscava se"){
+            const auto u = geom::douglas_peucker(p, 0.2);
+            const auto v = geom::visvalingam(p, 0.2);
+
+            CHECK(u.zatvoren());
+            CHECK(v.zatvoren());
+            CHECK(u.tacke().size() == 4);
+            REQUIRE(v.tacke().size() == 4);
+        }
+    }
+
+    GIVEN("Kratke linije"){
+        const geom::NizTacaka t{{0, 0}, {1, 1}};
+
+        REQUIRE(geom::douglas_peucker(t, 10) == t);
+        REQUIRE(geom::visvalingam(t, 10) == t);
+    }
+}
+
+SCENARIO("Nivoi detalja se poklapaju sa Douglas-Peucker", "[uprosti]"){
+    GIVEN("Nasumicna setnja"){
+        std::mt19937 gen(17);
+        std::normal_distribution<> dis(0, 1);
+
+        geom::NizTacaka t;
+        geom::Element x = 0, y = 0;
+        for (auto i = 0; i < 5000; i++){
+            t.emplace_back(x += dis(gen), y += dis(gen));
+        }
+
+        const geom::nivoi_detalja n(t);
+        CHECK(n.size() == t.size());
+
+        WHEN("Izdvaja se po toleranciji"){
+            bool isti = true;
+            for (const auto tol : {0.0, 0.3, 1.0, 2.5, 10.0, 50.0, 1e9}){
+                isti &= n.po_toleranciji(tol) == geom::douglas_peucker(t, tol);
+            }
+            REQUIRE(isti);
+        }
+
+        WHEN("Izdvaja se po broju"){
+            std::map<geom::Element, geom::Velicina> polozaj;
+            for (geom::Velicina i = 0; i < t.size(); i++){
+                polozaj[t[i][0]] = i;
+            }
+
+            bool ugnezdeno = true;
+            auto prethodno = n.po_broju(2);
+            CHECK(prethodno.size() == 2);
+            for (geom::Velicina k = 3; k <= 200; k++){
+                const auto sada = n.po_broju(k);
+                ugnezdeno &= sada.size() == k &&
+                             std::includes(std::cbegin(sada), std::cend(sada),
+                                           std::cbegin(prethodno), std::cend(prethodno),
+                                           [&polozaj](const geom::tacka& a, const geom::tacka& b)
+                                           {
+                                               return polozaj[a[0]] < polozaj[b[0]];
+                                           });
+                prethodno = sada;
+            }
+            CHECK(ugnezdeno);
+            REQUIRE(n.po_broju(t.size() + 10) == t);
+        }
+
+        WHEN("Trazi se znacaj nepostojeceg temena"){
+            REQUIRE_THROWS_AS(n.znacaj(t.size()), geom::Exc);
+        }
+    }
+}
@@ -1,5 +1,7 @@
 #include "catch.hpp"
 
+#include <limits>
+
 #include "../Cons/tacka.hpp"
 
 static const auto tol = 1e-5;
@@ -184,6 +186,51 @@ SCENARIO("Moguce je mnoziti matrice", "[mult]"){
                                     {0, 0, 1, -2},
                                     {0, 0, 0, 1}}, tol));
     }
+
+    GIVEN("Spremni afini koeficijenti"){
+        using Koef = std::array<double, 6>;
+
+        const Koef a{2, -1, 3,
+                     0.5, 4, -2};
+        const Koef b{1, 7, -1,
+                     -3, 0.25, 6};
+
+        // Opste mnozenje punih matrica
+        using Matrica = std::vector<std::vector<double>>;
+        const auto puna = [](const Koef& k){
+            return Matrica{{k[0], k[1], k[2]},
+                           {k[3], k[4], k[5]},
+                           { 0,    0,    1}};
+        };
+
+        Koef c;
+        util::mult_afin(a, b, c);
+        CHECK(util::jednakost(puna(c), util::mult(puna(a), puna(b)), tol));
+
+        // Rezultat sme biti i sam cinilac
+        auto d = a;
+        util::mult_afin(d, b, d);
+        CHECK(d == c);
+
+        auto e = b;
+        util::mult_afin(a, e, e);
+        CHECK(e == c);
+
+        WHEN("Stepenuje se u mestu"){
+            const auto exp = GENERATE(0u, 1u, 2u, 5u, 8u);
+
+            auto f = a;
+            util::pow_afin(f, exp);
+
+            auto h = puna(a);
+            auto g = puna({1, 0, 0, 0, 1, 0});
+            for (auto i = 0u; i < exp; i++){
+                g = util::mult(g, h);
+            }
+
+            REQUIRE(util::jednakost(puna(f), g, tol));
+        }
+    }
 }
 
 SCENARIO("Moguce je stepenovati matrice", "[pow]"){
@@ -229,6 +276,17 @@ SCENARIO("Moguce je stepenovati matrice", "[pow]"){
         CHECK(g.inv() == (g^-1));
         REQUIRE((g.inv()^5) == (g^-5));
 
+        WHEN("Stepen je najmanji int"){
+            const auto n = std::numeric_limits<int>::min();
+            const geom::geom t{{1, 0, 1},
+                               {0, 1, 0},
+                               {0, 0, 1}};
+
+            REQUIRE((t^n) == geom::geom{{1, 0, -2147483648.0},
+                                        {0, 1, 0},
+                                        {0, 0, 1}});
+        }
+
         WHEN("Matrica je singularna"){
             geom::geom m{{1, 1, 1},
                          {1, 1, 1},